@@ -228,6 +228,16 @@ namespace rascal {
         mod, manager_name.c_str());
     // bind the number of centers in the structure
     manager.def("__len__", &Manager_t::size);
+    manager.def("get_memory_usage", &Manager_t::get_memory_usage,
+                "Bytes used by the properties of the whole stack of managers.");
+    manager.def("get_memory_usage_by_property",
+                &Manager_t::get_memory_usage_by_property,
+                "Bytes used by each property of the stack of managers.");
+    manager.def(
+        "sweep_properties",
+        [](Manager_t & manager) { return manager.sweep_properties(); },
+        "Release the transient and the out of date properties of the stack "
+        "of managers.");
     return manager;
   }
 
@@ -243,6 +253,16 @@ namespace rascal {
         mod, manager_name.c_str());
     // bind the number of centers in the structure
     manager.def("__len__", &Manager_t::size);
+    manager.def("get_memory_usage", &Manager_t::get_memory_usage,
+                "Bytes used by the properties of the whole stack of managers.");
+    manager.def("get_memory_usage_by_property",
+                &Manager_t::get_memory_usage_by_property,
+                "Bytes used by each property of the stack of managers.");
+    manager.def(
+        "sweep_properties",
+        [](Manager_t & manager) { return manager.sweep_properties(); },
+        "Release the transient and the out of date properties of the stack "
+        "of managers.");
     return manager;
   }
 
@@ -334,11 +354,13 @@ namespace rascal {
                                            py::module & m_adaptor) {
       m_adaptor.def(
           name.c_str(),
-          [](ImplementationPtr_t & manager, double cutoff) {
+          [](ImplementationPtr_t & manager, double cutoff,
+             bool sort_by_distance) {
             return make_adapted_manager<AdaptorStrict, Implementation_t>(
-                manager, cutoff);
+                manager, cutoff, sort_by_distance);
           },
-          py::arg("manager"), py::arg("cutoff"), py::return_value_policy::copy);
+          py::arg("manager"), py::arg("cutoff"),
+          py::arg("sort_by_distance") = false, py::return_value_policy::copy);
     }
   };
 
@@ -469,6 +491,98 @@ namespace rascal {
                                                                 m_adaptor);
   }
 
+  /**
+   * Read-only numpy array of shape `shape` over data, without copy. The
+   * array keeps property alive so it stays valid as long as the property is
+   * not recomputed (which may move its storage).
+   */
+  template <class Prop_t>
+  py::array make_property_view(std::shared_ptr<Prop_t> property,
+                               const std::vector<size_t> & shape,
+                               const double * data) {
+    auto owner = new std::shared_ptr<Prop_t>(std::move(property));
+    py::capsule base(owner, [](void * ptr) {
+      delete static_cast<std::shared_ptr<Prop_t> *>(ptr);
+    });
+    py::array view(shape, data, base);
+    view.attr("setflags")(py::arg("write") = false);
+    return view;
+  }
+
+  //! the values of a Property as its (n_centers, nb_comp) feature matrix
+  template <class T, size_t Order, class Manager_t, Dim_t NbRow, Dim_t NbCol>
+  py::array get_property_view(
+      std::shared_ptr<Property<T, Order, Manager_t, NbRow, NbCol>> property) {
+    auto && values{property->get_raw_data_view()};
+    std::vector<size_t> shape{static_cast<size_t>(values.rows()),
+                              static_cast<size_t>(values.cols())};
+    return make_property_view(property, shape, values.data());
+  }
+
+  /**
+   * the storage of a BlockSparseProperty as a flat array, the entries being
+   * described by get_property_layout
+   */
+  template <class T, size_t Order, class Manager_t, class Key>
+  py::array get_property_view(
+      std::shared_ptr<BlockSparseProperty<T, Order, Manager_t, Key>>
+          property) {
+    auto && storage{property->get_storage_view()};
+    std::vector<size_t> shape{static_cast<size_t>(storage.size())};
+    return make_property_view(property, shape, storage.data());
+  }
+
+  /**
+   * Metadata to read the storage of a BlockSparseProperty: the position and
+   * layout id of each entry and, for each layout, its keys with the position
+   * of their blocks relative to the start of the entry.
+   */
+  template <class Prop_t>
+  py::dict get_property_layout(const Prop_t & property) {
+    py::dict info{};
+    auto && offsets{property.get_entry_offsets()};
+    auto && layout_ids{property.get_entry_layout_ids()};
+    info["entry_offsets"] = py::array_t<size_t>(offsets.size(), offsets.data());
+    info["layout_ids"] =
+        py::array_t<size_t>(layout_ids.size(), layout_ids.data());
+    py::list layouts{};
+    for (const auto & layout : property.get_layouts()) {
+      py::list keys{}, block_offsets{};
+      for (const auto & el : layout.offsets) {
+        keys.append(py::tuple(py::cast(el.first)));
+        block_offsets.append(el.second);
+      }
+      py::dict layout_info{};
+      layout_info["keys"] = keys;
+      layout_info["block_offsets"] = block_offsets;
+      // the blocks are stored in row major order
+      layout_info["block_shape"] = py::make_tuple(layout.n_row, layout.n_col);
+      layout_info["entry_size"] = layout.total_length;
+      layouts.append(layout_info);
+    }
+    info["layouts"] = layouts;
+    info["keys_uniform"] = property.are_keys_uniform();
+    return info;
+  }
+
+  //! the property of calculator in the structure i_structure
+  template <class Calculator, class ManagerCollection_t>
+  auto get_structure_property(ManagerCollection_t & managers,
+                              const Calculator & calculator, int i_structure) {
+    using Manager_t = typename ManagerCollection_t::Manager_t;
+    using Prop_t = typename Calculator::template Property_t<Manager_t>;
+    if (i_structure < 0 or
+        static_cast<size_t>(i_structure) >= managers.size()) {
+      std::stringstream error{};
+      error << "Structure index " << i_structure
+            << " is out of range for a collection of " << managers.size()
+            << " structures";
+      throw std::out_of_range(error.str());
+    }
+    return managers[i_structure]->template get_property<Prop_t>(
+        managers.get_calculator_name(calculator, false));
+  }
+
   template <class Calculator, class ManagerCollection_t,
             class ManagerCollectionBinder>
   void
@@ -476,6 +590,26 @@ namespace rascal {
     manager_collection.def(
         "get_features", &ManagerCollection_t::template get_features<Calculator>,
         py::call_guard<py::gil_scoped_release>());
+    manager_collection.def(
+        "get_features_shape",
+        &ManagerCollection_t::template get_features_shape<Calculator>);
+    // features has to be a writeable C contiguous float64 array, it is
+    // filled in place
+    manager_collection.def(
+        "fill_features",
+        &ManagerCollection_t::template fill_features<Calculator>,
+        py::arg("calculator"), py::arg("features").noconvert(),
+        py::arg("n_threads") = 1, py::call_guard<py::gil_scoped_release>());
+    manager_collection.def(
+        "get_structure_features_view",
+        [](ManagerCollection_t & managers, const Calculator & calculator,
+           int i_structure) {
+          return get_property_view(
+              get_structure_property(managers, calculator, i_structure));
+        },
+        R"(Read-only view of the features of one structure without copy. It
+           is only valid until the features are computed again.)",
+        py::arg("calculator"), py::arg("i_structure"));
   }
 
   /**
@@ -494,6 +628,24 @@ namespace rascal {
             class ManagerCollectionBinder>
   void bind_sparse_feature_matrix_getter(
       ManagerCollectionBinder & manager_collection) {
+    manager_collection.def(
+        "get_structure_features_layout",
+        [](ManagerCollection_t & managers, const Calculator & calculator,
+           int i_structure) {
+          return get_property_layout(
+              *get_structure_property(managers, calculator, i_structure));
+        },
+        R"(Keys and positions of the blocks of each center in the array of
+           get_structure_features_view.)",
+        py::arg("calculator"), py::arg("i_structure"));
+    manager_collection.def(
+        "get_features_gradient_shape",
+        &ManagerCollection_t::template get_features_gradient_shape<Calculator>);
+    manager_collection.def(
+        "fill_features_gradient",
+        &ManagerCollection_t::template fill_features_gradient<Calculator>,
+        py::arg("calculator"), py::arg("features").noconvert(),
+        py::arg("n_threads") = 1, py::call_guard<py::gil_scoped_release>());
     manager_collection.def(
         "get_features_by_species",
         [](ManagerCollection_t & managers, Calculator & calculator) {
@@ -688,6 +840,14 @@ namespace rascal {
       return std::string(v.get_adaptors_parameters().dump(2));
     });
 
+    manager_collection.def(
+        "get_memory_usage", &ManagerCollection_t::get_memory_usage,
+        "Bytes used by the properties of all the structures and the arenas.");
+    manager_collection.def(
+        "sweep_properties", &ManagerCollection_t::sweep_properties,
+        "Release the transient and the out of date properties of all the "
+        "structures.");
+
     bind_feature_matrix_getter<CalculatorSortedCoulomb, ManagerCollection_t>(
         manager_collection);
 
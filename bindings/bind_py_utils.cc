@@ -27,6 +27,7 @@
 
 #include "bind_py_utils.hh"
 
+#include "rascal/utils/instrumentation.hh"
 #include "rascal/utils/sparsify_fps.hh"
 
 namespace rascal {
@@ -52,5 +53,21 @@ namespace rascal {
         " space).",
         py::arg("feature_matrix"), py::arg("n_sparse"),
         py::arg("i_first_point"));
+
+    py::module m_instrumentation = mod.def_submodule("instrumentation");
+    m_instrumentation.doc() = "Timers and counters of the main steps of a "
+                              "calculation";
+
+    m_instrumentation.def("enable", &instrumentation::enable,
+                          "Start (or stop) recording the timers and counters.",
+                          py::arg("is_enabled") = true);
+    m_instrumentation.def("is_enabled", &instrumentation::is_enabled);
+    m_instrumentation.def("reset", &instrumentation::reset,
+                          "Forget all the timers and counters.");
+    m_instrumentation.def(
+        "get_report",
+        []() { return instrumentation::get_report().get<py::dict>(); },
+        "Get the timers as {name: {'seconds': ..., 'calls': ...}} under "
+        "'timers' and the counters as {name: count} under 'counters'.");
   }
 }  // namespace rascal
@@ -84,7 +84,7 @@ class AtomsList(object):
                                   self.nl_options, managers=new_managers)
         return new_atom_list
 
-    def get_features(self, calculator, species=None):
+    def get_features(self, calculator, species=None, n_threads=1):
         """
         Parameters
         -------
@@ -93,13 +93,20 @@ class AtomsList(object):
         species :  list of atomic number to use for building the dense feature
         matrix computed with calculators of name Spherical*
 
+        n_threads : number of threads copying the features of the structures
+        into the output array, used when species is None
+
         Returns
         -------
         represenation_matrix : ndarray
             returns the representation bound to the calculator as dense matrix.
         """
 
-        if species is None:
+        if species is None and n_threads > 1:
+            representation = calculator._representation
+            X = np.empty(self.managers.get_features_shape(representation))
+            self.managers.fill_features(representation, X, n_threads)
+        elif species is None:
             X = self.managers.get_features(
                 calculator._representation)
         else:
@@ -109,6 +116,45 @@ class AtomsList(object):
 
         return X
 
+    def get_structure_features_view(self, calculator, i_structure):
+        """
+        Parameters
+        -------
+        calculator : Calculator (an object owning a _representation object)
+
+        i_structure : index of the structure in the list
+
+        Returns
+        -------
+        representation_view : ndarray
+            read-only view of the representation of one structure, without
+            copy. For the calculators named Spherical* it is the flat storage
+            of the centers, described by get_structure_features_layout,
+            otherwise it is the (n_centers, n_features) feature matrix. The
+            view is only valid until the representation is computed again.
+        """
+        return self.managers.get_structure_features_view(
+            calculator._representation, i_structure)
+
+    def get_structure_features_layout(self, calculator, i_structure):
+        """
+        Parameters
+        -------
+        calculator : one of the representation calculators named Spherical*
+
+        i_structure : index of the structure in the list
+
+        Returns
+        -------
+        layout : dict
+            position ('entry_offsets') and layout id ('layout_ids') of each
+            center in get_structure_features_view, and for each layout the
+            keys, the position of their blocks in the center ('block_offsets')
+            and the shape of the blocks ('block_shape', row major)
+        """
+        return self.managers.get_structure_features_layout(
+            calculator._representation, i_structure)
+
     def get_features_by_species(self, calculator):
         """
         Parameters
@@ -3,6 +3,7 @@ from ..neighbourlist.base import NeighbourListFactory
 from ..neighbourlist.structure_manager import convert_to_structure_list
 
 import numpy as np
+import json
 import queue
 
 # Register Calculators
@@ -72,3 +73,25 @@ def cutoff_function_dict_switch(cutoff_function_type, **kwargs):
                                   ' has not been implemented.')
 
     return cutoff_function_dict
+
+
+def load_radial_basis_projection(projection):
+    """
+    return the radial_basis_projection hypers of a contracted radial basis
+
+    Parameters
+    ----------
+    projection : dict or string
+        dict with the 'expanded_max_radial' number of radial functions of the
+        underlying basis and the 'projection_matrices', one
+        (max_radial, expanded_max_radial) array per angular channel, or the
+        name of a json file containing such a dict
+    """
+    if isinstance(projection, str):
+        with open(projection, 'r') as f:
+            projection = json.load(f)
+    return dict(
+        expanded_max_radial=int(projection['expanded_max_radial']),
+        projection_matrices=[np.asarray(matrix, dtype=float).tolist()
+                             for matrix in projection['projection_matrices']]
+    )
@@ -1,6 +1,7 @@
 import json
 
-from .base import CalculatorFactory, cutoff_function_dict_switch
+from .base import (CalculatorFactory, cutoff_function_dict_switch,
+                   load_radial_basis_projection)
 from ..neighbourlist import AtomsList
 import numpy as np
 from ..utils import BaseIO
@@ -27,6 +28,12 @@ class SphericalExpansion(BaseIO):
     max_angular : int
         Highest angular momentum number (l) in the expansion
 
+    max_angular_per_radial : list of int
+        Highest angular momentum number kept for each radial channel n, i.e.
+        a ragged basis where the coefficients with l > max_angular_per_radial[n]
+        are zero and not computed. Should have max_radial entries that do not
+        increase with n. Defaults to max_angular for all n.
+
     gaussian_sigma_type : str
         How the Gaussian atom sigmas (smearing widths) are allowed to
         vary -- fixed ('Constant'), by species ('PerSpecies'), or by
@@ -38,7 +45,8 @@ class SphericalExpansion(BaseIO):
 
     expansion_by_species_method : string
         Specifies the how the species key of the invariant are set-up.
-        Possible values: 'environment wise', 'user defined', 'structure wise'.
+        Possible values: 'environment wise', 'user defined', 'structure wise',
+        'alchemical'.
         The descriptor is computed for each atomic enviroment and it is indexed
         using tuples of atomic species that are present within the environment.
         This index is by definition sparse since a species tuple will be non
@@ -49,6 +57,10 @@ class SphericalExpansion(BaseIO):
         'structure wise' means that within a structure the species tuples
         will be the same for each environment coefficients.
         'user defined' uses global_species to set-up the species tuples.
+        'alchemical' projects each species onto the pseudo species channels
+        given by species_coupling so the keys are the channel indices and the
+        number of features scales with the number of channels instead of the
+        number of species.
 
         These different settings correspond to different trade-off between
         the memory efficiency of the invariants and the computational
@@ -67,6 +79,35 @@ class SphericalExpansion(BaseIO):
         should contain all the species present in the structure for which
         invariants will be computed
 
+    species_coupling : list of list of float
+        matrix of shape (len(global_species), n_pseudo_species) holding the
+        weight of each species (in the order of global_species) in each pseudo
+        species channel. Only used when expansion_by_species_method is
+        'alchemical'.
+
+    gradient_atoms : list of int
+        indices of the atoms, within each structure, with respect to whose
+        positions the gradients are computed. The gradients with respect to
+        the other atoms are left empty (zero). Defaults to all the atoms.
+        Only used when compute_gradients is True and incompatible with a half
+        neighbour list.
+
+    cache_pair_geometry : bool
+        store the per pair cutoff function values and spherical harmonics in
+        the structure managers so that the other calculators computed on the
+        same managers reuse them: the cutoff function values are shared by
+        the calculators with the same cutoff function and the harmonics by
+        the ones with the same max_angular and compute_gradients, e.g.
+        calculators with several cutoffs computed on one neighbour list
+        built for the largest (sorted by distance so that each stops at its
+        own cutoff). Recomputed when the structure changes.
+
+    backing_directory : str
+        if given, store the expansion and its gradients in memory mapped
+        files created (and removed right away) in this directory instead of
+        in memory, so that the OS pages them to the disk when the dataset
+        does not fit in memory.
+
     Methods
     -------
     transform(frames)
@@ -86,7 +127,11 @@ class SphericalExpansion(BaseIO):
                  radial_basis="GTO",
                  optimization_args={},
                  expansion_by_species_method="environment wise",
-                 global_species=None, compute_gradients=False,
+                 global_species=None, species_coupling=None,
+                 compute_gradients=False, gradient_atoms=None,
+                 max_angular_per_radial=None,
+                 cache_pair_geometry=False,
+                 backing_directory=None,
                  cutoff_function_parameters=dict()):
         """Construct a SphericalExpansion representation
 
@@ -108,6 +153,20 @@ class SphericalExpansion(BaseIO):
             global_species=global_species,
             compute_gradients=compute_gradients
         )
+        if species_coupling is not None:
+            self.update_hyperparameters(
+                species_coupling=[list(row) for row in species_coupling])
+        if gradient_atoms is not None:
+            self.update_hyperparameters(
+                gradient_atoms=[int(idx) for idx in gradient_atoms])
+        if cache_pair_geometry:
+            self.update_hyperparameters(cache_pair_geometry=True)
+        if backing_directory is not None:
+            self.update_hyperparameters(
+                backing_directory=str(backing_directory))
+        if max_angular_per_radial is not None:
+            self.update_hyperparameters(
+                max_angular_per_radial=[int(l) for l in max_angular_per_radial])
         self.cutoff_function_parameters = deepcopy(cutoff_function_parameters)
         cutoff_function_parameters.update(
             interaction_cutoff=interaction_cutoff,
@@ -138,9 +197,13 @@ class SphericalExpansion(BaseIO):
                     # RadialContribution
                     print("Warning: default parameter for spline range is used.")
                     spline_range = (0, interaction_cutoff)
+                projection = optimization_args.get('radial_basis_projection')
                 optimization_args = {
                     'type': 'Spline', 'accuracy': accuracy, 'range': {
                         'begin': spline_range[0], 'end': spline_range[1]}}
+                if projection is not None:
+                    optimization_args['radial_basis_projection'] = \
+                        load_radial_basis_projection(projection)
             elif optimization_args['type'] == 'None':
                 optimization_args = dict({'type': 'None'})
             else:
@@ -188,7 +251,10 @@ class SphericalExpansion(BaseIO):
             'cutoff_function',
             'radial_contribution',
             'compute_gradients',
-            'cutoff_function_parameters', 'expansion_by_species_method', 'global_species'}
+            'cutoff_function_parameters', 'expansion_by_species_method', 'global_species',
+            'species_coupling', 'gradient_atoms',
+            'max_angular_per_radial', 'cache_pair_geometry',
+            'backing_directory'}
         hypers_clean = {key: hypers[key] for key in hypers
                         if key in allowed_keys}
         self.hypers.update(hypers_clean)
@@ -241,7 +307,13 @@ class SphericalExpansion(BaseIO):
             max_radial=self.hypers['max_radial'], max_angular=self.hypers['max_angular'],
             expansion_by_species_method=self.hypers['expansion_by_species_method'],
             global_species=self.hypers['global_species'],
+            species_coupling=self.hypers.get('species_coupling'),
             compute_gradients=self.hypers['compute_gradients'],
+            gradient_atoms=self.hypers.get('gradient_atoms'),
+            max_angular_per_radial=self.hypers.get('max_angular_per_radial'),
+            cache_pair_geometry=self.hypers.get('cache_pair_geometry',
+                                                False),
+            backing_directory=self.hypers.get('backing_directory'),
             gaussian_sigma_type=gaussian_density['type'],
             gaussian_sigma_constant=gaussian_density['gaussian_sigma']['value'],
             cutoff_function_type=cutoff_function['type'],
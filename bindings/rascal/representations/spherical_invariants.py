@@ -2,7 +2,8 @@ import json
 from itertools import product
 import ase
 
-from .base import CalculatorFactory, cutoff_function_dict_switch
+from .base import (CalculatorFactory, cutoff_function_dict_switch,
+                   load_radial_basis_projection)
 from ..neighbourlist import AtomsList
 import numpy as np
 from copy import deepcopy
@@ -40,6 +41,12 @@ class SphericalInvariants(BaseIO):
     max_angular : int
         Highest angular momentum number (l) in the expansion
 
+    max_angular_per_radial : list of int
+        Highest angular momentum number kept for each radial channel n, i.e.
+        a ragged basis where the coefficients with l > max_angular_per_radial[n]
+        are zero and not computed. Should have max_radial entries that do not
+        increase with n. Defaults to max_angular for all n.
+
     gaussian_sigma_type : str
         How the Gaussian atom sigmas (smearing widths) are allowed to
         vary -- fixed ('Constant'), by species ('PerSpecies'), or by
@@ -63,7 +70,8 @@ class SphericalInvariants(BaseIO):
 
     expansion_by_species_method : string
         Specifies the how the species key of the invariant are set-up.
-        Possible values: 'environment wise', 'user defined', 'structure wise'.
+        Possible values: 'environment wise', 'user defined', 'structure wise',
+        'alchemical'.
         The descriptor is computed for each atomic enviroment and it is indexed
         using tuples of atomic species that are present within the environment.
         This index is by definition sparse since a species tuple will be non
@@ -74,6 +82,10 @@ class SphericalInvariants(BaseIO):
         'structure wise' means that within a structure the species tuples
         will be the same for each environment coefficients.
         'user defined' uses global_species to set-up the species tuples.
+        'alchemical' projects each species onto the pseudo species channels
+        given by species_coupling so the keys are the channel indices and the
+        number of features scales with the number of channels instead of the
+        number of species.
 
         These different settings correspond to different trade-off between
         the memory efficiency of the invariants and the computational
@@ -92,6 +104,28 @@ class SphericalInvariants(BaseIO):
         should contain all the species present in the structure for which
         invariants will be computed
 
+    species_coupling : list of list of float
+        matrix of shape (len(global_species), n_pseudo_species) holding the
+        weight of each species (in the order of global_species) in each pseudo
+        species channel. Only used when expansion_by_species_method is
+        'alchemical'.
+
+    gradient_atoms : list of int
+        indices of the atoms, within each structure, with respect to whose
+        positions the gradients are computed. The gradients with respect to
+        the other atoms are left empty (zero). Defaults to all the atoms.
+        Only used when compute_gradients is True and incompatible with a half
+        neighbour list.
+
+    cache_pair_geometry : bool
+        share the cutoff function values and spherical harmonics of the pairs
+        with the other calculators computed on the same managers, see
+        SphericalExpansion.
+
+    backing_directory : str
+        store the representation and its gradients in memory mapped files
+        in this directory, see SphericalExpansion.
+
     compute_gradients : bool
         control the computation of the representation's gradients w.r.t. atomic
         positions.
@@ -157,6 +191,17 @@ class SphericalInvariants(BaseIO):
         :class:`..utils.FPSFilter` and :class:`..utils.CURFilter` with
         `act_on` set to `feature` output such dictionary.
 
+    power_spectrum_projection : dict or None
+        if not None and :code:`soap_type == 'PowerSpectrum'`, the power
+        spectrum of each species pair (a, b) is projected on the fly as
+        :math:`W^{ab} p^{ab}` and only the projected features are stored. It
+        has the form :code:`{'species_pairs': [[a, b], ...],
+        'projection_matrices': [W, ...]}` where each W has shape
+        (n_projected, max_radial**2 * (max_angular + 1)) and acts on the
+        power spectrum flattened in (n1, n2, l) order. All the species pairs
+        present in the structures must be listed. Incompatible with
+        coefficient_subselection.
+
     Methods
     -------
     transform(frames)
@@ -178,9 +223,14 @@ class SphericalInvariants(BaseIO):
                  optimization_args={},
                  expansion_by_species_method="environment wise",
                  global_species=None,
-                 compute_gradients=False,
+                 species_coupling=None,
+                 compute_gradients=False, gradient_atoms=None,
+                 max_angular_per_radial=None,
+                 cache_pair_geometry=False,
+                 backing_directory=None,
                  cutoff_function_parameters=dict(),
-                 coefficient_subselection=None):
+                 coefficient_subselection=None,
+                 power_spectrum_projection=None):
         """Construct a SphericalExpansion representation
 
         Required arguments are all the hyperparameters named in the
@@ -205,6 +255,28 @@ class SphericalInvariants(BaseIO):
         if self.hypers['coefficient_subselection'] is None:
             del self.hypers['coefficient_subselection']
 
+        if species_coupling is not None:
+            self.update_hyperparameters(
+                species_coupling=[list(row) for row in species_coupling])
+        if gradient_atoms is not None:
+            self.update_hyperparameters(
+                gradient_atoms=[int(idx) for idx in gradient_atoms])
+        if cache_pair_geometry:
+            self.update_hyperparameters(cache_pair_geometry=True)
+        if backing_directory is not None:
+            self.update_hyperparameters(
+                backing_directory=str(backing_directory))
+        if max_angular_per_radial is not None:
+            self.update_hyperparameters(
+                max_angular_per_radial=[int(l) for l in max_angular_per_radial])
+        if power_spectrum_projection is not None:
+            self.update_hyperparameters(power_spectrum_projection=dict(
+                species_pairs=[[int(sp) for sp in pair] for pair in
+                               power_spectrum_projection['species_pairs']],
+                projection_matrices=[
+                    np.asarray(matrix, dtype=float).tolist() for matrix in
+                    power_spectrum_projection['projection_matrices']]))
+
         self.cutoff_function_parameters = deepcopy(cutoff_function_parameters)
         cutoff_function_parameters.update(
             interaction_cutoff=interaction_cutoff,
@@ -235,9 +307,13 @@ class SphericalInvariants(BaseIO):
                     # RadialContribution
                     print("Warning: default parameter for spline range is used.")
                     spline_range = (0, interaction_cutoff)
+                projection = optimization_args.get('radial_basis_projection')
                 optimization_args = {
                     'type': 'Spline', 'accuracy': accuracy, 'range': {
                         'begin': spline_range[0], 'end': spline_range[1]}}
+                if projection is not None:
+                    optimization_args['radial_basis_projection'] = \
+                        load_radial_basis_projection(projection)
             elif optimization_args['type'] == 'None':
                 optimization_args = dict({'type': 'None'})
             else:
@@ -283,7 +359,11 @@ class SphericalInvariants(BaseIO):
                         'gaussian_density', 'radial_contribution',
                         'cutoff_function_parameters', 'expansion_by_species_method',
                         'compute_gradients',
-                        'global_species', 'coefficient_subselection'}
+                        'global_species', 'coefficient_subselection',
+                        'species_coupling', 'gradient_atoms',
+                        'max_angular_per_radial',
+                        'power_spectrum_projection', 'cache_pair_geometry',
+                        'backing_directory'}
         hypers_clean = {key: hypers[key] for key in hypers
                         if key in allowed_keys}
 
@@ -318,6 +398,10 @@ class SphericalInvariants(BaseIO):
         """
         if self.hypers['soap_type'] == 'RadialSpectrum':
             return (n_species * self.hypers['max_radial'])
+        if 'power_spectrum_projection' in self.hypers:
+            projection = self.hypers['power_spectrum_projection']
+            return (int((n_species * (n_species + 1)) / 2) *
+                    len(projection['projection_matrices'][0]))
         if self.hypers['soap_type'] == 'PowerSpectrum':
             return (int((n_species *
                          (n_species +
@@ -412,7 +496,15 @@ class SphericalInvariants(BaseIO):
             normalize=self.hypers['normalize'],
             expansion_by_species_method=self.hypers['expansion_by_species_method'],
             global_species=self.hypers['global_species'],
+            species_coupling=self.hypers.get('species_coupling'),
             compute_gradients=self.hypers['compute_gradients'],
+            gradient_atoms=self.hypers.get('gradient_atoms'),
+            max_angular_per_radial=self.hypers.get('max_angular_per_radial'),
+            power_spectrum_projection=self.hypers.get(
+                'power_spectrum_projection'),
+            cache_pair_geometry=self.hypers.get('cache_pair_geometry',
+                                                False),
+            backing_directory=self.hypers.get('backing_directory'),
             gaussian_sigma_type=gaussian_density['type'],
             gaussian_sigma_constant=gaussian_density['gaussian_sigma']['value'],
             cutoff_function_type=cutoff_function['type'],
@@ -10,6 +10,9 @@ from .scorer import get_score, print_score
 # function to redirect c++'s standard output to python's one
 ostream_redirect = utils.__dict__['ostream_redirect']
 
+# timers and counters of the neighbour lists, representations and kernels
+instrumentation = utils.__dict__['instrumentation']
+
 
 def is_notebook():
     from IPython import get_ipython
@@ -178,3 +178,81 @@ void ModifiedSphericalBessel::calc(double distance, double fac_a) {
     assert(this->bessel_gradients.isFinite().all());
   }
 }
+
+void ModifiedSphericalBessel::calc(
+    const Eigen::Ref<const Eigen::ArrayXd> & distances, double fac_a) {
+  const int n_distances{static_cast<int>(distances.size())};
+  const int n_entries{n_distances * this->n_max};
+  // flatten the (distance, x_n) pairs with x_n varying fastest
+  Eigen::ArrayXd xs{this->x_v.replicate(n_distances, 1)};
+  Eigen::ArrayXd rs(n_entries);
+  for (int i_distance{0}; i_distance < n_distances; ++i_distance) {
+    rs.segment(i_distance * this->n_max, this->n_max) = distances[i_distance];
+  }
+  Eigen::ArrayXd args{2. * fac_a * rs * xs};
+  Eigen::ArrayXd args_i{args.inverse()};
+
+  auto & vals{this->batch_values};
+  vals.resize(n_entries, this->order_max);
+  Eigen::ArrayXd exp_minus{Eigen::exp(-fac_a * (xs - rs).square())};
+  Eigen::ArrayXd exp_plus{Eigen::exp(-fac_a * (xs + rs).square())};
+  // i_0(z) = sinh(z) / z
+  vals.col(0) = (exp_minus - exp_plus) * 0.5 * args_i;
+
+  if (this->order_max > 1) {
+    // upward recursion over the whole batch, only kept where args > 50
+    // i_1(z) = cosh(z)/z - i_0(z)/z
+    vals.col(1) = (exp_minus + exp_plus) * 0.5 * args_i - vals.col(0) * args_i;
+    for (int order{2}; order < this->order_max; ++order) {
+      vals.col(order) =
+          vals.col(order - 2) - vals.col(order - 1) * (2. * order - 1.) * args_i;
+    }
+
+    // downward recursion seeded with 1F1 where args <= 50, the other entries
+    // are seeded with 0 and discarded
+    auto & down{this->batch_downward};
+    down.resize(n_entries, this->order_max);
+    Eigen::ArrayXd efacs{Eigen::exp(-fac_a * (rs.square() + xs.square()))};
+    for (int i_order{0}; i_order < 2; ++i_order) {
+      int order{this->order_max - 2 + i_order};
+      auto & hyp1f1{this->hyp1f1s[i_order]};
+      for (int ii{0}; ii < n_entries; ++ii) {
+        if (args[ii] > 50) {
+          down(ii, order) = 0.;
+        } else {
+          down(ii, order) = std::exp(-args[ii]) * this->igammas[i_order] *
+                            math::pow(args[ii] * 0.5, order) * 0.5 *
+                            math::SQRT_PI * hyp1f1.calc(2. * args[ii]);
+        }
+      }
+      down.col(order) *= efacs;
+    }
+    for (int order{this->order_max - 3}; order >= 0; --order) {
+      down.col(order) =
+          down.col(order + 2) + down.col(order + 1) * (2. * order + 3.) * args_i;
+    }
+
+    auto use_upward{args > 50};
+    for (int order{0}; order < this->order_max; ++order) {
+      vals.col(order) = use_upward.select(vals.col(order), down.col(order));
+    }
+  }
+  assert(vals.isFinite().all());
+
+  vals = (vals < 1e-100).select(0., vals);
+
+  if (this->compute_gradients) {
+    auto & grads{this->batch_gradients};
+    grads = vals.leftCols(this->l_max + 1);
+    grads.colwise() *= -2. * fac_a * rs;
+    Eigen::ArrayXd dfacs{2. * fac_a * xs};
+    grads.col(0) += dfacs * vals.col(1);
+    for (int i_order{1}; i_order < this->order_max - 1; i_order++) {
+      grads.col(i_order) += dfacs *
+                            (i_order * vals.col(i_order - 1) +
+                             (i_order + 1) * vals.col(i_order + 1)) /
+                            (2 * i_order + 1);
+    }
+    assert(grads.isFinite().all());
+  }
+}
@@ -80,6 +80,20 @@ namespace rascal {
        */
       void calc(double distance, double fac_a);
 
+      /**
+       * Compute all the MBSFs for a batch of distances at once, e.g. all the
+       * neighbours of a center. The results for the i-th distance are
+       * accessed with get_values(i) and get_gradients(i).
+       *
+       * The (distance, x_n) pairs are laid out in one flat array so that the
+       * recursions are vectorized over the whole batch. The choice between
+       * upward and downward recursion is made per entry with a mask instead
+       * of a branch, and the confluent hypergeometric seeds are only
+       * evaluated for the entries that need the downward recursion.
+       */
+      void calc(const Eigen::Ref<const Eigen::ArrayXd> & distances,
+                double fac_a);
+
       /**
        * Initialize arrays for the computation of
        * @param x_v      Eigen::Array of x-values (part of the argument of the
@@ -120,6 +134,24 @@ namespace rascal {
        */
       ArrayConstRef_t get_gradients() { return this->bessel_gradients; }
 
+      /**
+       * Return a reference to the Bessel function values of the i-th
+       * distance of the last batched calc()
+       */
+      ArrayConstRef_t get_values(size_t i_distance) {
+        return this->batch_values.block(i_distance * this->n_max, 0,
+                                        this->n_max, this->l_max + 1);
+      }
+
+      /**
+       * Return a reference to the Bessel function gradients of the i-th
+       * distance of the last batched calc()
+       */
+      ArrayConstRef_t get_gradients(size_t i_distance) {
+        return this->batch_gradients.block(i_distance * this->n_max, 0,
+                                           this->n_max, this->l_max + 1);
+      }
+
      private:
       /**
        * Compute the MBSFs times two exponentials that complete the square
@@ -180,6 +212,13 @@ namespace rascal {
       Eigen::ArrayXXd bessel_values{};
       Eigen::ArrayXXd bessel_gradients{};
 
+      //! values and gradients of the batched calc(), (distance, x_n) along
+      //! the rows with x_n varying fastest and the orders along the columns
+      Eigen::ArrayXXd batch_values{};
+      Eigen::ArrayXXd batch_gradients{};
+      //! buffer for the downward recursion of the batched calc()
+      Eigen::ArrayXXd batch_downward{};
+
       Eigen::ArrayXd bessel_arg{};
       Eigen::ArrayXd bessel_arg_i{};
       Eigen::ArrayXd exp_bessel_arg{};
@@ -0,0 +1,311 @@
+/**
+ * @file   clebsch_gordan.cc
+ *
+ * @author  Felix Musil <felix.musil@epfl.ch>
+ *
+ * @date   18 October 2026
+ *
+ * @brief Sparse Clebsch-Gordan couplings of real spherical expansion
+ *        coefficients
+ *
+ * Copyright  2026  Felix Musil, COSMO (EPFL), LAMMM (EPFL)
+ *
+ * Rascal is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3, or (at
+ * your option) any later version.
+ *
+ * Rascal is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file LICENSE. If not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#include "rascal/math/clebsch_gordan.hh"
+
+#include <wigxjpf.h>
+
+#include <algorithm>
+#include <complex>
+#include <stdexcept>
+
+using namespace rascal::math;  // NOLINT
+
+namespace {
+  using complex = std::complex<double>;
+
+  //! couplings smaller than this are cancellations of the real combinations
+  constexpr double COUPLING_ZERO_TOL{1e-12};
+
+  /**
+   * Complex coefficient c_{lm} as the linear combination
+   * alpha[0] r_{lm[0]} + alpha[1] r_{lm[1]} of the real ones, i.e. the
+   * inverse of the definition of the real spherical harmonics in
+   * rascal/math/spherical_harmonics.hh
+   */
+  struct RealToComplex {
+    std::array<int, 2> lm;
+    std::array<complex, 2> alpha;
+  };
+
+  RealToComplex real_to_complex(int l, int m) {
+    const int lm0{l * l + l};
+    if (m > 0) {
+      const double sign{m % 2 == 0 ? INV_SQRT_TWO : -INV_SQRT_TWO};
+      return {{{lm0 + m, lm0 - m}}, {{complex{sign, 0.}, complex{0., sign}}}};
+    } else if (m == 0) {
+      return {{{lm0, lm0}}, {{complex{1., 0.}, complex{0., 0.}}}};
+    } else {
+      return {{{lm0 - m, lm0 + m}},
+              {{complex{INV_SQRT_TWO, 0.}, complex{0., -INV_SQRT_TWO}}}};
+    }
+  }
+
+  bool is_triangle(int l1, int l2, int l3) {
+    return (l1 >= std::abs(l2 - l3)) and (l1 <= l2 + l3);
+  }
+}  // namespace
+
+void SparseClebschGordan::precompute_bispectrum(size_t max_angular,
+                                                bool inversion_symmetry) {
+  const int l_max{static_cast<int>(max_angular)};
+  std::vector<Couplings_t> couplings{};
+  wig_table_init(2 * (l_max + 1), 3);
+  wig_temp_init(2 * (l_max + 1));
+  for (int l1{0}; l1 < l_max + 1; ++l1) {
+    for (int l2{0}; l2 < l_max + 1; ++l2) {
+      for (int l3{0}; l3 < l_max + 1; ++l3) {
+        if (not is_triangle(l1, l2, l3)) {
+          continue;
+        }
+        const bool is_even{(l1 + l2 + l3) % 2 == 0};
+        if (inversion_symmetry and not is_even) {
+          continue;
+        }
+        std::map<std::array<int, 3>, complex> complex_couplings{};
+        for (int m1{-l1}; m1 < l1 + 1; ++m1) {
+          for (int m2{-l2}; m2 < l2 + 1; ++m2) {
+            const int m3{-m1 - m2};
+            if (std::abs(m3) > l3) {
+              continue;
+            }
+            const double w3j{
+                wig3jj(2 * l1, 2 * l2, 2 * l3, 2 * m1, 2 * m2, 2 * m3)};
+            const auto c1{real_to_complex(l1, m1)};
+            const auto c2{real_to_complex(l2, m2)};
+            const auto c3{real_to_complex(l3, m3)};
+            for (int i1{0}; i1 < 2; ++i1) {
+              for (int i2{0}; i2 < 2; ++i2) {
+                for (int i3{0}; i3 < 2; ++i3) {
+                  complex_couplings[{{c1.lm[i1], c2.lm[i2], c3.lm[i3]}}] +=
+                      w3j * c1.alpha[i1] * c2.alpha[i2] * c3.alpha[i3];
+                }
+              }
+            }
+          }
+        }
+        // the invariants are purely real or imaginary depending on the
+        // parity of l1 + l2 + l3
+        couplings.emplace_back();
+        for (const auto & el : complex_couplings) {
+          couplings.back()[el.first] =
+              is_even ? el.second.real() : el.second.imag();
+        }
+      }
+    }
+  }
+  wig_temp_free();
+  wig_table_free();
+  this->compress(3, couplings);
+}
+
+void SparseClebschGordan::precompute_lambda_spectrum(size_t max_angular,
+                                                     size_t lambda,
+                                                     bool inversion_symmetry) {
+  const int l_max{static_cast<int>(max_angular)};
+  const int l3{static_cast<int>(lambda)};
+  std::vector<Couplings_t> couplings{};
+  const int two_j_max{2 * (std::max(l_max, l3) + 1)};
+  wig_table_init(two_j_max, 3);
+  wig_temp_init(two_j_max);
+  for (int l1{0}; l1 < l_max + 1; ++l1) {
+    for (int l2{0}; l2 < l_max + 1; ++l2) {
+      if (not is_triangle(l1, l2, l3)) {
+        continue;
+      }
+      const bool is_even{(l1 + l2 + l3) % 2 == 0};
+      if (inversion_symmetry and not is_even) {
+        continue;
+      }
+      // real combinations of the 3j symbols of the components +m3 and -m3,
+      // enumerated as (m1, m2, m3)
+      std::vector<double> w3js{};
+      for (int m1{-l1}; m1 < l1 + 1; ++m1) {
+        for (int m2{-l2}; m2 < l2 + 1; ++m2) {
+          for (int m3{-l3}; m3 < l3 + 1; ++m3) {
+            if ((m1 + m2 + m3 != 0) and (m1 + m2 - m3 != 0)) {
+              continue;
+            }
+            const double w3j1{
+                wig3jj(2 * l1, 2 * l2, 2 * l3, 2 * m1, 2 * m2, 2 * m3)};
+            const double w3j2{
+                wig3jj(2 * l1, 2 * l2, 2 * l3, 2 * m1, 2 * m2, -2 * m3)};
+            const double sign{m3 % 2 == 0 ? 1. : -1.};
+            if (m3 > 0) {
+              w3js.push_back((w3j2 + sign * w3j1) * INV_SQRT_TWO);
+            } else if (m3 < 0) {
+              w3js.push_back((w3j1 - sign * w3j2) * INV_SQRT_TWO);
+            } else {
+              w3js.push_back(w3j1);
+            }
+          }
+        }
+      }
+      // the symbols are consumed in the (m3, m1, m2) order of the
+      // lambda-spectrum components, as in the reference implementation
+      size_t i_w3j{0};
+      for (int m3{-l3}; m3 < l3 + 1; ++m3) {
+        const complex phase{m3 < 0 ? complex{0., 1.} : complex{1., 0.}};
+        std::map<std::array<int, 3>, complex> complex_couplings{};
+        for (int m1{-l1}; m1 < l1 + 1; ++m1) {
+          for (int m2{-l2}; m2 < l2 + 1; ++m2) {
+            if ((m1 + m2 + m3 != 0) and (m1 + m2 - m3 != 0)) {
+              continue;
+            }
+            const double w3j{w3js[i_w3j++]};
+            const auto c1{real_to_complex(l1, m1)};
+            const auto c2{real_to_complex(l2, m2)};
+            for (int i1{0}; i1 < 2; ++i1) {
+              for (int i2{0}; i2 < 2; ++i2) {
+                complex_couplings[{{c1.lm[i1], c2.lm[i2], 0}}] +=
+                    w3j * phase * c1.alpha[i1] * c2.alpha[i2];
+              }
+            }
+          }
+        }
+        couplings.emplace_back();
+        for (const auto & el : complex_couplings) {
+          couplings.back()[el.first] =
+              is_even ? el.second.real() : el.second.imag();
+        }
+      }
+    }
+  }
+  wig_temp_free();
+  wig_table_free();
+  this->compress(2, couplings);
+}
+
+void SparseClebschGordan::compress(size_t order,
+                                   const std::vector<Couplings_t> & couplings) {
+  if (order != 2 and order != 3) {
+    throw std::logic_error("SparseClebschGordan: order should be 2 or 3");
+  }
+  this->order = order;
+  this->output_offsets.assign(1, 0);
+  this->group_lms.clear();
+  this->group_offsets.assign(1, 0);
+  this->term_lms.clear();
+  this->term_weights.clear();
+  // index of the lm that is summed over first
+  const size_t i_last{order - 1};
+  for (const auto & output_couplings : couplings) {
+    bool new_group{true};
+    std::array<int, 2> group_lm{{-1, -1}};
+    for (const auto & el : output_couplings) {
+      if (std::abs(el.second) < COUPLING_ZERO_TOL) {
+        continue;
+      }
+      const std::array<int, 2> lm{
+          {el.first[0], order == 3 ? el.first[1] : 0}};
+      // the map is sorted so the terms of a group are contiguous
+      if (new_group or lm != group_lm) {
+        if (not new_group) {
+          this->group_offsets.push_back(this->term_lms.size());
+        }
+        this->group_lms.push_back(lm);
+        group_lm = lm;
+        new_group = false;
+      }
+      this->term_lms.push_back(el.first[i_last]);
+      this->term_weights.push_back(el.second);
+    }
+    if (not new_group) {
+      this->group_offsets.push_back(this->term_lms.size());
+    }
+    this->output_offsets.push_back(this->group_lms.size());
+  }
+}
+
+void SparseClebschGordan::contract(const Matrix_Ref & coefficients1,
+                                   const Matrix_Ref & coefficients2,
+                                   Eigen::Ref<Matrix_t> result) const {
+  if (this->order != 2) {
+    throw std::logic_error("SparseClebschGordan: the couplings are not of "
+                           "order 2");
+  }
+  const Eigen::Index n_radial2{coefficients2.cols()};
+  Vector_t coefficients2_sum(n_radial2);
+  result.setZero();
+  for (size_t i_out{0}; i_out < this->get_n_outputs(); ++i_out) {
+    auto result_row = result.row(i_out);
+    for (size_t i_group{this->output_offsets[i_out]};
+         i_group < this->output_offsets[i_out + 1]; ++i_group) {
+      // sum over the coefficients of the last set first
+      coefficients2_sum.setZero();
+      for (size_t i_term{this->group_offsets[i_group]};
+           i_term < this->group_offsets[i_group + 1]; ++i_term) {
+        coefficients2_sum +=
+            this->term_weights[i_term] *
+            coefficients2.row(this->term_lms[i_term]);
+      }
+      const int lm1{this->group_lms[i_group][0]};
+      for (Eigen::Index n1{0}; n1 < coefficients1.cols(); ++n1) {
+        result_row.segment(n1 * n_radial2, n_radial2) +=
+            coefficients1(lm1, n1) * coefficients2_sum;
+      }
+    }
+  }
+}
+
+void SparseClebschGordan::contract(const Matrix_Ref & coefficients1,
+                                   const Matrix_Ref & coefficients2,
+                                   const Matrix_Ref & coefficients3,
+                                   Eigen::Ref<Matrix_t> result) const {
+  if (this->order != 3) {
+    throw std::logic_error("SparseClebschGordan: the couplings are not of "
+                           "order 3");
+  }
+  const Eigen::Index n_radial2{coefficients2.cols()};
+  const Eigen::Index n_radial3{coefficients3.cols()};
+  Vector_t coefficients3_sum(n_radial3);
+  result.setZero();
+  for (size_t i_out{0}; i_out < this->get_n_outputs(); ++i_out) {
+    auto result_row = result.row(i_out);
+    for (size_t i_group{this->output_offsets[i_out]};
+         i_group < this->output_offsets[i_out + 1]; ++i_group) {
+      // sum over the coefficients of the last set first
+      coefficients3_sum.setZero();
+      for (size_t i_term{this->group_offsets[i_group]};
+           i_term < this->group_offsets[i_group + 1]; ++i_term) {
+        coefficients3_sum +=
+            this->term_weights[i_term] *
+            coefficients3.row(this->term_lms[i_term]);
+      }
+      const int lm1{this->group_lms[i_group][0]};
+      const int lm2{this->group_lms[i_group][1]};
+      for (Eigen::Index n1{0}; n1 < coefficients1.cols(); ++n1) {
+        for (Eigen::Index n2{0}; n2 < n_radial2; ++n2) {
+          result_row.segment((n1 * n_radial2 + n2) * n_radial3, n_radial3) +=
+              (coefficients1(lm1, n1) * coefficients2(lm2, n2)) *
+              coefficients3_sum;
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,146 @@
+/**
+ * @file   rascal/math/clebsch_gordan.hh
+ *
+ * @author  Felix Musil <felix.musil@epfl.ch>
+ *
+ * @date   18 October 2026
+ *
+ * @brief Sparse Clebsch-Gordan couplings of real spherical expansion
+ *        coefficients
+ *
+ * Copyright  2026  Felix Musil, COSMO (EPFL), LAMMM (EPFL)
+ *
+ * Rascal is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3, or (at
+ * your option) any later version.
+ *
+ * Rascal is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file LICENSE. If not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef SRC_RASCAL_MATH_CLEBSCH_GORDAN_HH_
+#define SRC_RASCAL_MATH_CLEBSCH_GORDAN_HH_
+
+#include "rascal/math/utils.hh"
+
+#include <array>
+#include <map>
+#include <vector>
+
+namespace rascal {
+  namespace math {
+    /**
+     * Sparse tensor coupling 2 or 3 sets of spherical expansion coefficients
+     * c_{n lm} (real spherical harmonics convention of
+     * rascal/math/spherical_harmonics.hh) into rotationally invariant or
+     * covariant features.
+     *
+     * Each output component k (e.g. one (l_1, l_2, l_3) of the bispectrum)
+     * is
+     *
+     * \f{equation}{
+     *   q^k_{n_1 n_2 n_3} = \sum_e w_e\, c^1_{n_1 \mu_e} c^2_{n_2 \nu_e}
+     *                       c^3_{n_3 \rho_e},
+     * \f}
+     *
+     * where the sum runs only over the non zero couplings e. The Wigner 3j
+     * symbols and the conversion from complex to real spherical harmonics are
+     * folded in the real weights w_e when the tensor is precomputed, so that
+     * the contraction involves neither complex arithmetic nor the selection
+     * rules.
+     */
+    class SparseClebschGordan {
+     public:
+      /**
+       * Couplings of the bispectrum: one output per (l_1, l_2, l_3)
+       * fulfilling the triangle rule (and l_1 + l_2 + l_3 even if
+       * inversion_symmetry), in lexicographic order.
+       */
+      void precompute_bispectrum(size_t max_angular, bool inversion_symmetry);
+
+      /**
+       * Couplings of the lambda-spectrum: one output per (l_1, l_2, m) with
+       * (l_1, l_2, lambda) fulfilling the triangle rule (and l_1 + l_2 +
+       * lambda even if inversion_symmetry) and -lambda <= m <= lambda, in
+       * lexicographic order.
+       */
+      void precompute_lambda_spectrum(size_t max_angular, size_t lambda,
+                                      bool inversion_symmetry);
+
+      /**
+       * Contract two sets of coefficients. The coefficients are given as
+       * (lm, n) matrices, i.e. transposed with respect to the storage of the
+       * spherical expansion, and result is set to the (n_outputs, n_1 * n_2)
+       * features with columns ordered as (n_1, n_2).
+       */
+      void contract(const Matrix_Ref & coefficients1,
+                    const Matrix_Ref & coefficients2,
+                    Eigen::Ref<Matrix_t> result) const;
+
+      /**
+       * Contract three sets of coefficients, see above. result is set to the
+       * (n_outputs, n_1 * n_2 * n_3) features with columns ordered as (n_1,
+       * n_2, n_3).
+       */
+      void contract(const Matrix_Ref & coefficients1,
+                    const Matrix_Ref & coefficients2,
+                    const Matrix_Ref & coefficients3,
+                    Eigen::Ref<Matrix_t> result) const;
+
+      //! number of coupled sets of coefficients
+      size_t get_order() const { return this->order; }
+
+      //! number of output components
+      size_t get_n_outputs() const {
+        return this->output_offsets.empty() ? 0
+                                            : this->output_offsets.size() - 1;
+      }
+
+      //! number of non zero couplings
+      size_t get_n_couplings() const { return this->term_weights.size(); }
+
+      bool operator==(const SparseClebschGordan & other) const {
+        return (this->order == other.order and
+                this->output_offsets == other.output_offsets and
+                this->group_lms == other.group_lms and
+                this->group_offsets == other.group_offsets and
+                this->term_lms == other.term_lms and
+                this->term_weights == other.term_weights);
+      }
+
+     protected:
+      //! couplings of one output keyed by the lm indices of the coefficients
+      using Couplings_t = std::map<std::array<int, 3>, double>;
+
+      /**
+       * Store the couplings of each output dropping the ones that vanish.
+       * Couplings sharing all but their last lm index are grouped so that the
+       * last set of coefficients is summed over first in the contraction.
+       */
+      void compress(size_t order, const std::vector<Couplings_t> & couplings);
+
+      size_t order{0};
+      //! [begin, end) of the groups of each output
+      std::vector<size_t> output_offsets{};
+      //! leading lm indices of each group (the second is unused if order 2)
+      std::vector<std::array<int, 2>> group_lms{};
+      //! [begin, end) of the terms of each group
+      std::vector<size_t> group_offsets{};
+      //! last lm index of each term
+      std::vector<int> term_lms{};
+      //! weight of each term
+      std::vector<double> term_weights{};
+    };
+
+  }  // namespace math
+}  // namespace rascal
+
+#endif  // SRC_RASCAL_MATH_CLEBSCH_GORDAN_HH_
@@ -30,6 +30,7 @@
 
 #include "rascal/math/utils.hh"
 #include "rascal/structure_managers/structure_manager_collection.hh"
+#include "rascal/utils/instrumentation.hh"
 #include "rascal/utils/json_io.hh"
 
 namespace rascal {
@@ -60,6 +61,65 @@ namespace rascal {
       return std::move(kernel);
     }
 
+    /**
+     * Features of the managers as one dense matrix, available when they are
+     * gathered in the arena of a ManagerCollection (see
+     * ManagerCollection::make_arena). Other containers of managers have no
+     * arena.
+     */
+    template <class Property_t, class StructureManagers>
+    bool has_arena(const StructureManagers & /*managers*/,
+                   const std::string & /*representation_name*/) {
+      return false;
+    }
+
+    template <class Property_t, class Manager,
+              template <class> class... AdaptorImplementationPack>
+    bool has_arena(
+        const ManagerCollection<Manager, AdaptorImplementationPack...> &
+            managers,
+        const std::string & representation_name) {
+      return managers.template has_arena<Property_t>(representation_name);
+    }
+
+    template <class Property_t, class StructureManagers>
+    Eigen::Map<const math::Matrix_t>
+    get_arena_view(const StructureManagers & /*managers*/,
+                   const std::string & /*representation_name*/) {
+      throw std::runtime_error("The structure managers have no arena");
+    }
+
+    template <class Property_t, class Manager,
+              template <class> class... AdaptorImplementationPack>
+    Eigen::Map<const math::Matrix_t> get_arena_view(
+        const ManagerCollection<Manager, AdaptorImplementationPack...> &
+            managers,
+        const std::string & representation_name) {
+      return managers.template get_arena_view<Property_t>(representation_name);
+    }
+
+    //! both sets of managers have arenas with the same columns
+    template <class Property_t, class StructureManagers>
+    bool have_compatible_arenas(const StructureManagers & /*managers_a*/,
+                                const StructureManagers & /*managers_b*/,
+                                const std::string & /*representation_name*/) {
+      return false;
+    }
+
+    template <class Property_t, class Manager,
+              template <class> class... AdaptorImplementationPack>
+    bool have_compatible_arenas(
+        const ManagerCollection<Manager, AdaptorImplementationPack...> &
+            managers_a,
+        const ManagerCollection<Manager, AdaptorImplementationPack...> &
+            managers_b,
+        const std::string & representation_name) {
+      return (managers_a.template has_arena<Property_t>(representation_name) and
+              managers_b.template has_arena<Property_t>(representation_name) and
+              managers_a.get_arena_keys(representation_name) ==
+                  managers_b.get_arena_keys(representation_name));
+    }
+
     struct KernelImplBase {
       using Hypers_t = json;
     };
@@ -185,6 +245,17 @@ namespace rascal {
       math::Matrix_t compute(const StructureManagers & managers_a,
                              const StructureManagers & managers_b,
                              const std::string & representation_name) {
+        if (have_compatible_arenas<Property_t>(managers_a, managers_b,
+                                               representation_name)) {
+          // all the features of each set are already in one matrix
+          auto features_a =
+              get_arena_view<Property_t>(managers_a, representation_name);
+          auto features_b =
+              get_arena_view<Property_t>(managers_b, representation_name);
+          math::Matrix_t kernel = features_a * features_b.transpose();
+          return pow_zeta(std::move(kernel), this->zeta);
+        }
+
         size_t n_centersA{0};
         for (const auto & manager_a : managers_a) {
           n_centersA += manager_a->size();
@@ -231,6 +302,16 @@ namespace rascal {
                 class StructureManagers>
       math::Matrix_t compute(const StructureManagers & managers_a,
                              const std::string & representation_name) {
+        if (has_arena<Property_t>(managers_a, representation_name)) {
+          auto features =
+              get_arena_view<Property_t>(managers_a, representation_name);
+          math::Matrix_t kernel(features.rows(), features.rows());
+          // same as features * features.transpose() using syrk
+          kernel = kernel.setZero().selfadjointView<Eigen::Upper>().rankUpdate(
+              features);
+          return pow_zeta(std::move(kernel), this->zeta);
+        }
+
         size_t n_centersA{0};
         for (const auto & manager_a : managers_a) {
           n_centersA += manager_a->size();
@@ -371,6 +452,7 @@ namespace rascal {
                                   const StructureManagers & managers_a,
                                   const StructureManagers & managers_b) {
       using internal::KernelType;
+      instrumentation::ScopedTimer timer{"kernel"};
 
       if (this->kernel_type == KernelType::Cosine) {
         auto kernel = downcast_kernel_impl<KernelType::Cosine>(kernel_impl);
@@ -415,6 +497,7 @@ namespace rascal {
     math::Matrix_t compute_helper(const std::string & representation_name,
                                   const StructureManagers & managers_a) {
       using internal::KernelType;
+      instrumentation::ScopedTimer timer{"kernel"};
 
       if (this->kernel_type == KernelType::Cosine) {
         auto kernel = downcast_kernel_impl<KernelType::Cosine>(kernel_impl);
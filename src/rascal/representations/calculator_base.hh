@@ -62,7 +62,8 @@ namespace rascal {
     CalculatorBase(CalculatorBase && other) noexcept
         : name{std::move(other.name)}, default_prefix{std::move(
                                            other.default_prefix)},
-          hypers{}, options{std::move(other.options)} {
+          backing_directory{std::move(other.backing_directory)}, hypers{},
+          options{std::move(other.options)} {
       this->hypers = std::move(other.hypers);
     }
 
@@ -111,6 +112,25 @@ namespace rascal {
       }
     }
 
+    /**
+     * Optional "backing_directory" hyper: store the representations in
+     * memory mapped files created in this directory so that datasets larger
+     * than the memory can be processed, see
+     * BlockSparseProperty::set_backing_directory.
+     */
+    void set_backing_directory(const Hypers_t & hypers) {
+      if (hypers.count("backing_directory") == 1) {
+        this->backing_directory =
+            hypers["backing_directory"].get<std::string>();
+      } else {
+        this->backing_directory.clear();
+      }
+    }
+
+    const std::string & get_backing_directory() const {
+      return this->backing_directory;
+    }
+
     /**
      * Returns if the calculator is able to compute gradients of the
      * representation w.r.t. atomic positions. Default implementation returns
@@ -136,6 +156,8 @@ namespace rascal {
     std::string name{""};
     //! default prefix of the calculator
     std::string default_prefix{""};
+    //! where to store the representations, in memory if empty
+    std::string backing_directory{""};
 
     //! stores all the hyper parameters of the representation
     Hypers_t hypers{};
@@ -0,0 +1,97 @@
+/**
+ * @file   rascal/representations/calculator_instantiations.hh
+ *
+ * @author  Felix Musil <felix.musil@epfl.ch>
+ *
+ * @date   18 October 2026
+ *
+ * @brief Calculators compiled in librascal for the standard manager stacks
+ *
+ * Copyright  2026  Felix Musil, COSMO (EPFL), LAMMM (EPFL)
+ *
+ * Rascal is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3, or (at
+ * your option) any later version.
+ *
+ * Rascal is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file LICENSE. If not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef SRC_RASCAL_REPRESENTATIONS_CALCULATOR_INSTANTIATIONS_HH_
+#define SRC_RASCAL_REPRESENTATIONS_CALCULATOR_INSTANTIATIONS_HH_
+
+#include "rascal/representations/calculator_sorted_coulomb.hh"
+#include "rascal/representations/calculator_spherical_covariants.hh"
+#include "rascal/representations/calculator_spherical_expansion.hh"
+#include "rascal/representations/calculator_spherical_invariants.hh"
+#include "rascal/structure_managers/adaptor_center_contribution.hh"
+#include "rascal/structure_managers/adaptor_neighbour_list.hh"
+#include "rascal/structure_managers/adaptor_strict.hh"
+#include "rascal/structure_managers/structure_manager_centers.hh"
+#include "rascal/structure_managers/structure_manager_collection.hh"
+
+#include <memory>
+
+namespace rascal {
+
+  /*
+   * The compute functions of the calculators on the stacks of managers used
+   * by the python bindings are explicitly instantiated in the translation
+   * units of the calculators (e.g. calculator_spherical_expansion.cc).
+   * Including this header instead of the calculator headers links against
+   * them rather than compiling them again.
+   */
+
+  //! stack of managers of the sorted coulomb matrix
+  using StrictNLManager_t =
+      AdaptorStrict<AdaptorNeighbourList<StructureManagerCenters>>;
+  using StrictNLCollection_t =
+      ManagerCollection<StructureManagerCenters, AdaptorNeighbourList,
+                        AdaptorStrict>;
+
+  //! stack of managers of the spherical calculators
+  using StrictNLCCManager_t = AdaptorStrict<
+      AdaptorCenterContribution<AdaptorNeighbourList<StructureManagerCenters>>>;
+  using StrictNLCCCollection_t =
+      ManagerCollection<StructureManagerCenters, AdaptorNeighbourList,
+                        AdaptorCenterContribution, AdaptorStrict>;
+
+  extern template void
+  CalculatorSortedCoulomb::compute<std::shared_ptr<StrictNLManager_t>>(
+      std::shared_ptr<StrictNLManager_t> & managers);
+  extern template void
+  CalculatorSortedCoulomb::compute<StrictNLCollection_t>(
+      StrictNLCollection_t & managers);
+
+  extern template void
+  CalculatorSphericalExpansion::compute<std::shared_ptr<StrictNLCCManager_t>>(
+      std::shared_ptr<StrictNLCCManager_t> & managers);
+  extern template void
+  CalculatorSphericalExpansion::compute<StrictNLCCCollection_t>(
+      StrictNLCCCollection_t & managers);
+
+  extern template void
+  CalculatorSphericalInvariants::compute<std::shared_ptr<StrictNLCCManager_t>>(
+      std::shared_ptr<StrictNLCCManager_t> & managers);
+  extern template void
+  CalculatorSphericalInvariants::compute<StrictNLCCCollection_t>(
+      StrictNLCCCollection_t & managers);
+
+  extern template void
+  CalculatorSphericalCovariants::compute<std::shared_ptr<StrictNLCCManager_t>>(
+      std::shared_ptr<StrictNLCCManager_t> & managers);
+  extern template void
+  CalculatorSphericalCovariants::compute<StrictNLCCCollection_t>(
+      StrictNLCCCollection_t & managers);
+
+}  // namespace rascal
+
+#endif  // SRC_RASCAL_REPRESENTATIONS_CALCULATOR_INSTANTIATIONS_HH_
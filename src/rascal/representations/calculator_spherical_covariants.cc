@@ -0,0 +1,38 @@
+/**
+ * @file   rascal/representations/calculator_spherical_covariants.cc
+ *
+ * @author  Felix Musil <felix.musil@epfl.ch>
+ *
+ * @date   18 October 2026
+ *
+ * @brief  spherical covariants compiled for the standard manager stacks
+ *
+ * Copyright  2026  Felix Musil, COSMO (EPFL), LAMMM (EPFL)
+ *
+ * Rascal is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3, or (at
+ * your option) any later version.
+ *
+ * Rascal is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file LICENSE. If not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#include "rascal/representations/calculator_instantiations.hh"
+
+namespace rascal {
+
+  template void
+  CalculatorSphericalCovariants::compute<std::shared_ptr<StrictNLCCManager_t>>(
+      std::shared_ptr<StrictNLCCManager_t> & managers);
+  template void CalculatorSphericalCovariants::compute<StrictNLCCCollection_t>(
+      StrictNLCCCollection_t & managers);
+
+}  // namespace rascal
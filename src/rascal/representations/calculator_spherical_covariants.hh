@@ -31,6 +31,7 @@
 #ifndef SRC_RASCAL_REPRESENTATIONS_CALCULATOR_SPHERICAL_COVARIANTS_HH_
 #define SRC_RASCAL_REPRESENTATIONS_CALCULATOR_SPHERICAL_COVARIANTS_HH_
 
+#include "rascal/math/clebsch_gordan.hh"
 #include "rascal/math/utils.hh"
 #include "rascal/representations/calculator_base.hh"
 #include "rascal/representations/calculator_spherical_expansion.hh"
@@ -52,103 +53,6 @@ namespace rascal {
 
   namespace internal {
     enum class SphericalCovariantsType { LambdaSpectrum };
-
-    inline Eigen::ArrayXd precompute_wigner_3js(size_t max_angular,
-                                                bool inversion_symmetry,
-                                                size_t lambda) {
-      Eigen::ArrayXd wigner_3js{};
-      // get the number of non zero elements in the w3j
-      // Use the well-known selection rules for the Wigner 3j symbols
-      int n_elements{0};
-      size_t l3{lambda};
-      for (size_t l1{0}; l1 < max_angular + 1; ++l1) {
-        for (size_t l2{0}; l2 < max_angular + 1; ++l2) {
-          // Triangle rule
-          if (l1 < static_cast<size_t>(std::abs<int>(l2 - l3)) ||
-              l1 > l2 + l3) {
-            continue;
-          }
-          if (inversion_symmetry) {
-            if ((l1 + l2 + l3) % 2 == 1) {
-              continue;
-            }
-          }
-          for (size_t m1{0}; m1 < 2 * l1 + 1; m1++) {
-            int m1s{static_cast<int>(m1 - l1)};
-            for (size_t m2{0}; m2 < 2 * l2 + 1; m2++) {
-              int m2s{static_cast<int>(m2 - l2)};
-              for (size_t m3{0}; m3 < 2 * l3 + 1; m3++) {
-                int m3s{static_cast<int>(m3 - l3)};
-                // Selection rule for m
-                if ((m1s + m2s + m3s != 0) && (m1s + m2s - m3s != 0)) {
-                  continue;
-                }
-                ++n_elements;
-              }
-            }
-          }
-        }
-      }
-
-      wigner_3js.resize(n_elements);
-      n_elements = 0;
-      wig_table_init(2 * (max_angular + 1), 3);
-      wig_temp_init(2 * (max_angular + 1));
-      for (size_t l1{0}; l1 < max_angular + 1; ++l1) {
-        for (size_t l2{0}; l2 < max_angular + 1; ++l2) {
-          if ((l1 < static_cast<size_t>(std::abs<int>(l2 - l3))) ||
-              (l1 > l2 + l3)) {
-            continue;
-          }
-          if (inversion_symmetry) {
-            if ((l1 + l2 + l3) % 2 == 1) {
-              continue;
-            }
-          }
-          for (size_t m1{0}; m1 < 2 * l1 + 1; m1++) {
-            int m1s{static_cast<int>(m1 - l1)};
-            for (size_t m2{0}; m2 < 2 * l2 + 1; m2++) {
-              int m2s{static_cast<int>(m2 - l2)};
-              for (size_t m3{0}; m3 < 2 * l3 + 1; m3++) {
-                int m3s{static_cast<int>(m3 - l3)};
-                if ((m1s + m2s + m3s != 0) && (m1s + m2s - m3s != 0)) {
-                  continue;
-                }
-                double w3j1{
-                    wig3jj(2 * l1, 2 * l2, 2 * l3, 2 * m1s, 2 * m2s, 2 * m3s)};
-                double w3j2{
-                    wig3jj(2 * l1, 2 * l2, 2 * l3, 2 * m1s, 2 * m2s, -2 * m3s)};
-                if (m3s > 0) {
-                  wigner_3js(n_elements) =
-                      (w3j2 + math::pow(-1, m3s) * w3j1) * math::INV_SQRT_TWO;
-                } else if (m3s < 0) {
-                  wigner_3js(n_elements) =
-                      ((w3j1 - math::pow(-1, m3s) * w3j2)) * math::INV_SQRT_TWO;
-                } else if (m3s == 0) {
-                  wigner_3js(n_elements) = w3j1;
-                }
-                // change to the following for agreement with SOAPFAST
-                // (different definition of the real spherical harmonics)
-                /*
-                if (m3s > 0) { wigner_3js.push_back((w3j1 + pow(-1,
-                m3s)*w3j2)/sqrt(2.0)); } else if (m3s == 0) {
-                wigner_3js.push_back(w3j1); } else if (m3s < 0) {
-                wigner_3js.push_back(((w3j2 - pow(-1,
-                m3s)*w3j1))/sqrt(2.0));
-                }
-                */
-                ++n_elements;
-              }
-            }
-          }
-        }
-      }
-      wig_temp_free();
-      wig_table_free();
-
-      return wigner_3js;
-    }
-
   }  // namespace internal
 
   class CalculatorSphericalCovariants : public CalculatorBase {
@@ -184,14 +88,15 @@ namespace rascal {
     //! Move constructor
     CalculatorSphericalCovariants(
         CalculatorSphericalCovariants && other) noexcept
-        : CalculatorBase{std::move(other)}, max_radial{std::move(
-                                                other.max_radial)},
-          max_angular{std::move(other.max_angular)}, rep_expansion{std::move(
-                                                         other.rep_expansion)},
-          type{std::move(other.type)}, wigner_3js{std::move(other.wigner_3js)},
+        : CalculatorBase{std::move(other)},
+          max_radial{std::move(other.max_radial)},
+          max_angular{std::move(other.max_angular)},
+          rep_expansion{std::move(other.rep_expansion)},
+          type{std::move(other.type)},
+          lambda_couplings{std::move(other.lambda_couplings)},
           inversion_symmetry{std::move(other.inversion_symmetry)},
-          lambda{std::move(other.lambda)}, normalize{
-                                               std::move(other.normalize)} {}
+          lambda{std::move(other.lambda)},
+          normalize{std::move(other.normalize)} {}
 
     //! Destructor
     virtual ~CalculatorSphericalCovariants() = default;
@@ -209,7 +114,7 @@ namespace rascal {
               this->max_angular == other.max_angular and
               this->rep_expansion == other.rep_expansion and
               this->type == other.type and
-              (this->wigner_3js.array() == other.wigner_3js.array()).all() and
+              this->lambda_couplings == other.lambda_couplings and
               this->inversion_symmetry == other.inversion_symmetry and
               this->lambda == other.lambda and
               this->normalize == other.normalize);
@@ -226,8 +131,8 @@ namespace rascal {
 
       if (soap_type == "LambdaSpectrum") {
         this->type = SphericalCovariantsType::LambdaSpectrum;
-        this->wigner_3js = internal::precompute_wigner_3js(
-            this->max_angular, this->inversion_symmetry, this->lambda);
+        this->lambda_couplings.precompute_lambda_spectrum(
+            this->max_angular, this->lambda, this->inversion_symmetry);
 
       } else {
         throw std::logic_error("Requested Spherical Covariants type '" +
@@ -294,8 +199,8 @@ namespace rascal {
     CalculatorSphericalExpansion rep_expansion;
     internal::SphericalCovariantsType type{};
 
-    /// precomputed wigner symbols
-    Eigen::ArrayXd wigner_3js{};
+    /// non zero Clebsch-Gordan couplings of the lambda-spectrum
+    math::SparseClebschGordan lambda_couplings{};
 
     bool inversion_symmetry{false};
     size_t lambda{0};
@@ -395,7 +300,6 @@ namespace rascal {
     using Prop_t = Property_t<StructureManager>;
     using internal::SphericalCovariantsType;
     using math::pow;
-    using complex = std::complex<double>;
 
     // Compute the spherical expansions of the current structure
     rep_expansion.compute(manager);
@@ -417,6 +321,9 @@ namespace rascal {
 
     Key_t p_type{0, 0};
     internal::SortedKey<Key_t> pair_type{p_type};
+    // buffer for the lambda-spectrum of one species pair
+    math::Matrix_t soap_by_type(this->lambda_couplings.get_n_outputs(),
+                                math::pow(this->max_radial, 2_size_t));
 
     for (auto center : manager) {
       auto & coefficients{expansions_coefficients[center]};
@@ -429,100 +336,13 @@ namespace rascal {
           pair_type[1] = el2.first[0];
           auto & coef2{el2.second};
 
-          size_t & l3{this->lambda};
           if (soap_vector.count(pair_type) == 1) {
             auto && soap_vector_by_type{soap_vector[pair_type]};
-
-            size_t nn{0};
-            for (size_t n1{0}; n1 < this->max_radial; n1++) {
-              for (size_t n2{0}; n2 < this->max_radial; n2++) {
-                size_t l0{0};
-                int wigner_count{0};
-                for (size_t l1{0}; l1 < this->max_angular + 1; l1++) {
-                  for (size_t l2{0}; l2 < this->max_angular + 1; l2++) {
-                    if ((l1 < static_cast<size_t>(std::abs<int>(l2 - l3))) ||
-                        (l1 > l2 + l3)) {
-                      continue;
-                    }
-                    if (this->inversion_symmetry == true) {
-                      if ((l1 + l2 + l3) % 2 == 1) {
-                        continue;
-                      }
-                    }
-                    for (size_t m3{0}; m3 < 2 * l3 + 1; m3++) {
-                      int m3s{static_cast<int>(m3 - l3)};
-                      for (size_t m1{0}; m1 < 2 * l1 + 1; m1++) {
-                        int m1s{static_cast<int>(m1 - l1)};
-                        size_t lm1{pow(l1, 2_size_t) + m1};
-                        for (size_t m2{0}; m2 < 2 * l2 + 1; m2++) {
-                          int m2s{static_cast<int>(m2 - l2)};
-                          if ((m1s + m2s + m3s != 0) &&
-                              (m1s + m2s - m3s != 0)) {
-                            continue;
-                          }
-                          size_t lm2{pow(l2, 2_size_t) + m2};
-                          complex coef1c, coef2c;
-                          double w3j = this->wigner_3js[wigner_count];
-                          // usual formulae for converting from real to complex
-                          // These are the inverses of the formulae we used to
-                          // define the real spherical harmonics in
-                          // src/math/spherical_harmonics.hh
-                          if (m1s > 0) {
-                            coef1c = pow(-1.0, m1s) *
-                                     complex(coef1(n1, lm1),
-                                             coef1(n1, lm1 - 2 * m1s));
-                          } else if (m1s == 0) {
-                            coef1c =
-                                complex(coef1(n1, lm1), 0.0) * math::SQRT_TWO;
-                          } else if (m1s < 0) {
-                            coef1c = complex(coef1(n1, lm1 - 2 * m1s),
-                                             -coef1(n1, lm1));
-                          }
-                          if (m2s > 0) {
-                            coef2c = pow(-1.0, m2s) *
-                                     complex(coef2(n2, lm2),
-                                             coef2(n2, lm2 - 2 * m2s));
-                          } else if (m2s == 0) {
-                            coef2c =
-                                complex(coef2(n2, lm2), 0.0) * math::SQRT_TWO;
-                          } else if (m2s < 0) {
-                            coef2c = complex{coef2(n2, lm2 - 2 * m2s),
-                                             -coef2(n2, lm2)};
-                          }
-                          coef1c *= math::INV_SQRT_TWO;
-                          coef2c *= math::INV_SQRT_TWO;
-
-                          // combine the coefficients with Wigner 3j symbols
-                          // TODO(andrea, michael) avoid complex arithmetic
-                          complex i_unit{0.0, 1.0};
-                          if ((l1 + l2 + l3) % 2 == 0) {
-                            if (m3s < 0) {
-                              soap_vector_by_type(nn, l0) +=
-                                  w3j * (i_unit * coef1c * coef2c).real();
-                            } else {
-                              soap_vector_by_type(nn, l0) +=
-                                  w3j * (coef1c * coef2c).real();
-                            }
-                          } else if (this->inversion_symmetry == false) {
-                            if (m3s < 0) {
-                              soap_vector_by_type(nn, l0) +=
-                                  w3j * (i_unit * coef1c * coef2c).imag();
-                            } else {
-                              soap_vector_by_type(nn, l0) +=
-                                  w3j * (coef1c * coef2c).imag();
-                            }
-                          }
-                          wigner_count++;
-                        }  // m2
-                      }    // m1
-                      l0++;
-                    }  // m3
-                  }    // l2
-                }      // l1
-                nn++;
-              }  // n2
-            }    // n1
-          }      // if pair_type count
+            // the coupling works on (lm, n) ordered coefficients
+            this->lambda_couplings.contract(coef1.transpose(),
+                                            coef2.transpose(), soap_by_type);
+            soap_vector_by_type += soap_by_type.transpose();
+          }  // if pair_type count
         }        // coef1
       }          // coef1
 
@@ -39,9 +39,11 @@
 #include "rascal/math/utils.hh"
 #include "rascal/representations/calculator_base.hh"
 #include "rascal/representations/cutoff_functions.hh"
+#include "rascal/structure_managers/flat_pair_list.hh"
 #include "rascal/structure_managers/make_structure_manager.hh"
 #include "rascal/structure_managers/property_block_sparse.hh"
 #include "rascal/structure_managers/structure_manager.hh"
+#include "rascal/utils/instrumentation.hh"
 #include "rascal/utils/utils.hh"
 
 #include <Eigen/Dense>
@@ -298,6 +300,14 @@ namespace rascal {
       // virtual Vector_Ref compute_center_contribution() = 0;
       // virtual Matrix_Ref compute_neighbour_contribution() = 0;
       // virtual Matrix_Ref compute_neighbour_derivative() = 0;
+      // and their batched counterparts over the neighbours of a center
+      // virtual void compute_neighbour_contributions() = 0;
+      // virtual Matrix_Ref get_neighbour_contribution() = 0;
+      // virtual Matrix_Ref get_neighbour_derivative() = 0;
+
+      //! distances given to compute_neighbour_contributions() when the
+      //! contributions are evaluated lazily one neighbour at a time
+      Eigen::ArrayXd neighbour_distances{};
     };
 
     template <RadialBasisType RBT>
@@ -614,11 +624,52 @@ namespace rascal {
         return Matrix_Ref(this->radial_neighbour_derivative);
       }
 
+      /**
+       * Store the distances of all the neighbours of a center. The
+       * hypergeometric functions are not batched so the contributions are
+       * evaluated one neighbour at a time by get_neighbour_contribution().
+       */
+      void compute_neighbour_contributions(
+          const Eigen::Ref<const Eigen::ArrayXd> & distances,
+          const double fac_a) {
+        this->neighbour_distances = distances;
+        this->neighbour_fac_a = fac_a;
+      }
+
+      //! contribution of the i_neigh-th neighbour of the current batch
+      template <size_t Order, size_t Layer>
+      Matrix_Ref
+      get_neighbour_contribution(const size_t i_neigh,
+                                 const ClusterRefKey<Order, Layer> & /*pair*/) {
+        return this->compute_neighbour_contribution(
+            this->neighbour_distances(i_neigh), this->neighbour_fac_a);
+      }
+
+      /**
+       * Radial derivative of the i_neigh-th neighbour contribution, must be
+       * called after get_neighbour_contribution() for the same neighbour
+       */
+      template <size_t Order, size_t Layer>
+      Matrix_Ref
+      get_neighbour_derivative(const size_t i_neigh,
+                               const ClusterRefKey<Order, Layer> & pair) {
+        return this->compute_neighbour_derivative(
+            this->neighbour_distances(i_neigh), pair);
+      }
+
       template <typename Coeffs>
       void finalize_coefficients(Coeffs & coefficients) const {
         coefficients.lhs_dot(this->ortho_norm_matrix);
       }
 
+      //! matrix multiplying the coefficients in finalize_coefficients()
+      Eigen::MatrixXd get_ortho_norm_matrix() const {
+        return this->ortho_norm_matrix.transpose();
+      }
+
+      //! the orthonormalization combines all the radial channels
+      bool mixes_radial_channels() const { return true; }
+
       template <int NDims, typename Coeffs, typename Center>
       void finalize_coefficients_der(Coeffs & coefficients_gradient,
                                      Center & center) const {
@@ -713,6 +764,7 @@ namespace rascal {
       // And derivatives
       Matrix_t radial_neighbour_derivative{};
       // and of course, d/dr of the center contribution is zero
+      double neighbour_fac_a{};
 
       Hypers_t hypers{};
       // some usefull parameters
@@ -908,9 +960,51 @@ namespace rascal {
         return Matrix_Ref(this->radial_neighbour_derivative);
       }
 
+      /**
+       * Evaluate the Bessel functions of all the neighbours of a center in
+       * one batch, the contributions are then accessed with
+       * get_neighbour_contribution()
+       */
+      void compute_neighbour_contributions(
+          const Eigen::Ref<const Eigen::ArrayXd> & distances,
+          const double fac_a) {
+        this->bessel.calc(distances, fac_a);
+      }
+
+      //! contribution of the i_neigh-th neighbour of the current batch
+      template <size_t Order, size_t Layer>
+      Matrix_Ref
+      get_neighbour_contribution(const size_t i_neigh,
+                                 const ClusterRefKey<Order, Layer> & /*pair*/) {
+        this->radial_integral_neighbour =
+            this->legendre_radial_factor.asDiagonal() *
+            this->bessel.get_values(i_neigh).matrix();
+
+        return Matrix_Ref(this->radial_integral_neighbour);
+      }
+
+      //! radial derivative of the i_neigh-th neighbour contribution
+      template <size_t Order, size_t Layer>
+      Matrix_Ref
+      get_neighbour_derivative(const size_t i_neigh,
+                               const ClusterRefKey<Order, Layer> & /*pair*/) {
+        this->radial_neighbour_derivative =
+            this->legendre_radial_factor.asDiagonal() *
+            this->bessel.get_gradients(i_neigh).matrix();
+
+        return Matrix_Ref(this->radial_neighbour_derivative);
+      }
+
       template <typename Coeffs>
       void finalize_coefficients(Coeffs & /*coefficients*/) const {}
 
+      //! the DVR basis is orthonormal by construction
+      Eigen::MatrixXd get_ortho_norm_matrix() const {
+        return Eigen::MatrixXd::Identity(this->max_radial, this->max_radial);
+      }
+
+      bool mixes_radial_channels() const { return false; }
+
       template <int NDims, typename Coeffs, typename Center>
       void finalize_coefficients_der(Coeffs & /*coefficients_gradient*/,
                                      Center & /*center*/) const {}
@@ -939,6 +1033,85 @@ namespace rascal {
       Vector_t legendre_points2{};
     };
 
+    /**
+     * Contracted radial basis: the optional radial_basis_projection entry of
+     * the optimization hypers holds one (max_radial x expanded_max_radial)
+     * matrix per angular channel, e.g. obtained from a PCA of the expansion
+     * coefficients of a reference dataset. The underlying radial basis is
+     * built with expanded_max_radial functions and the projections (together
+     * with the orthonormalization) are folded into the interpolator, so only
+     * the max_radial contracted functions are evaluated.
+     *
+     * @return the radial_basis_projection hypers or an empty json
+     */
+    inline json get_radial_basis_projection(const json & hypers) {
+      auto && radial_contribution_hypers = hypers.at("radial_contribution");
+      if (radial_contribution_hypers.count("optimization")) {
+        auto && optimization_hypers =
+            radial_contribution_hypers.at("optimization");
+        if (optimization_hypers.count("radial_basis_projection")) {
+          return optimization_hypers.at("radial_basis_projection");
+        }
+      }
+      return json{};
+    }
+
+    /**
+     * Hypers used to build the expanded radial basis underlying a contracted
+     * one, i.e. with max_radial replaced by expanded_max_radial.
+     */
+    inline json get_expanded_radial_basis_hypers(const json & hypers) {
+      json projection_hypers = get_radial_basis_projection(hypers);
+      if (projection_hypers.is_null()) {
+        return hypers;
+      }
+      json expanded_hypers = hypers;
+      expanded_hypers["max_radial"] =
+          projection_hypers.at("expanded_max_radial").get<size_t>();
+      return expanded_hypers;
+    }
+
+    /**
+     * Ragged basis: the optional max_angular_per_radial hyper gives the
+     * largest angular channel l_max(n) kept for each radial channel n. It
+     * should not increase with n so that the radial channels kept for a given
+     * l are the first n_max(l) ones.
+     *
+     * @return l_max(n) for n < max_radial (max_angular for all n by default)
+     *
+     * @throw logic_error if the list is not consistent with max_radial and
+     *        max_angular or increases with n
+     */
+    inline std::vector<size_t> get_max_angular_per_radial(const json & hypers) {
+      auto max_radial = hypers.at("max_radial").get<size_t>();
+      auto max_angular = hypers.at("max_angular").get<size_t>();
+      if (not hypers.count("max_angular_per_radial") or
+          hypers.at("max_angular_per_radial").is_null()) {
+        return std::vector<size_t>(max_radial, max_angular);
+      }
+      auto l_maxs =
+          hypers.at("max_angular_per_radial").get<std::vector<size_t>>();
+      if (l_maxs.size() != max_radial) {
+        std::stringstream err_str{};
+        err_str << "max_angular_per_radial should have max_radial entries: "
+                << l_maxs.size() << " != " << max_radial;
+        throw std::logic_error(err_str.str());
+      }
+      for (size_t n{0}; n < max_radial; ++n) {
+        if (l_maxs[n] > max_angular) {
+          std::stringstream err_str{};
+          err_str << "max_angular_per_radial[" << n << "] = " << l_maxs[n]
+                  << " is larger than max_angular = " << max_angular;
+          throw std::logic_error(err_str.str());
+        }
+        if (n > 0 and l_maxs[n] > l_maxs[n - 1]) {
+          throw std::logic_error(
+              "max_angular_per_radial should not increase with n");
+        }
+      }
+      return l_maxs;
+    }
+
     /* A RadialContributionHandler handles the different cases of
      * AtomicSmearingType and OptimizationType. Depending on these template
      * parameters different member variables have to be used and different
@@ -989,6 +1162,12 @@ namespace rascal {
         return Parent::compute_neighbour_derivative(distance, pair);
       }
 
+      //! prepare the contributions of all the neighbours of a center
+      void compute_neighbour_contributions(
+          const Eigen::Ref<const Eigen::ArrayXd> & distances) {
+        Parent::compute_neighbour_contributions(distances, this->fac_a);
+      }
+
      protected:
       void precompute_fac_a() {
         auto smearing{downcast_atomic_smearing<AtomicSmearingType::Constant>(
@@ -1022,8 +1201,9 @@ namespace rascal {
           math::RefinementMethod_t::Exponential>;
 
       explicit RadialContributionHandler(const Hypers_t & hypers)
-          : Parent(hypers) {
+          : Parent(get_expanded_radial_basis_hypers(hypers)) {
         this->precompute();
+        this->init_projections(hypers);
         this->init_interpolator(hypers);
       }
 
@@ -1031,8 +1211,9 @@ namespace rascal {
       explicit RadialContributionHandler(const Hypers_t & hypers,
                                          const double x1, const double x2,
                                          const double accuracy)
-          : Parent(hypers) {
+          : Parent(get_expanded_radial_basis_hypers(hypers)) {
         this->precompute();
+        this->init_projections(hypers);
         this->init_interpolator(x1, x2, accuracy);
       }
       // Returns the precomputed center contribution
@@ -1060,6 +1241,56 @@ namespace rascal {
         return Matrix_Ref(this->radial_neighbour_derivative);
       }
 
+      /**
+       * Store the distances of all the neighbours of a center, the
+       * interpolator is evaluated one neighbour at a time
+       */
+      void compute_neighbour_contributions(
+          const Eigen::Ref<const Eigen::ArrayXd> & distances) {
+        this->neighbour_distances = distances;
+      }
+
+      template <size_t Order, size_t Layer>
+      Matrix_Ref
+      get_neighbour_contribution(const size_t i_neigh,
+                                 const ClusterRefKey<Order, Layer> & pair) {
+        return this->compute_neighbour_contribution(
+            this->neighbour_distances(i_neigh), pair);
+      }
+
+      template <size_t Order, size_t Layer>
+      Matrix_Ref
+      get_neighbour_derivative(const size_t i_neigh,
+                               const ClusterRefKey<Order, Layer> & pair) {
+        return this->compute_neighbour_derivative(
+            this->neighbour_distances(i_neigh), pair);
+      }
+
+      /**
+       * The orthonormalization of a contracted basis is already folded into
+       * the interpolator.
+       */
+      template <typename Coeffs>
+      void finalize_coefficients(Coeffs & coefficients) const {
+        if (not this->is_contracted) {
+          Parent::finalize_coefficients(coefficients);
+        }
+      }
+
+      //! a contracted basis is folded with its orthonormalization
+      bool mixes_radial_channels() const {
+        return not this->is_contracted and Parent::mixes_radial_channels();
+      }
+
+      template <int NDims, typename Coeffs, typename Center>
+      void finalize_coefficients_der(Coeffs & coefficients_gradient,
+                                     Center & center) const {
+        if (not this->is_contracted) {
+          Parent::template finalize_coefficients_der<NDims>(
+              coefficients_gradient, center);
+        }
+      }
+
      protected:
       void precompute() override {
         this->precompute_fac_a();
@@ -1075,6 +1306,72 @@ namespace rascal {
       void precompute_center_contribution() {
         Parent::compute_center_contribution(this->fac_a);
       }
+
+      /**
+       * Read the projection matrices of a contracted radial basis, fold the
+       * orthonormalization of the expanded basis into them and contract the
+       * center contribution.
+       *
+       * @throw logic_error if the projection matrices have the wrong shape
+       */
+      void init_projections(const Hypers_t & hypers) {
+        json projection_hypers = get_radial_basis_projection(hypers);
+        this->is_contracted = not projection_hypers.is_null();
+        if (not this->is_contracted) {
+          return;
+        }
+        const size_t max_radial{
+            hypers.at("max_radial").template get<size_t>()};
+        auto matrices = projection_hypers.at("projection_matrices")
+                            .get<std::vector<std::vector<std::vector<double>>>>();
+        if (matrices.size() != this->max_angular + 1) {
+          std::stringstream err_str{};
+          err_str << "radial_basis_projection should contain max_angular+1="
+                  << this->max_angular + 1 << " projection_matrices but "
+                  << matrices.size() << " were given.";
+          throw std::logic_error(err_str.str());
+        }
+        const Eigen::MatrixXd ortho_norm_matrix{
+            Parent::get_ortho_norm_matrix()};
+        this->projections.clear();
+        for (const auto & matrix : matrices) {
+          Eigen::MatrixXd projection(max_radial, this->max_radial);
+          if (matrix.size() != max_radial) {
+            std::stringstream err_str{};
+            err_str << "projection_matrices should have max_radial="
+                    << max_radial << " rows but " << matrix.size()
+                    << " were given.";
+            throw std::logic_error(err_str.str());
+          }
+          for (size_t i_row{0}; i_row < max_radial; ++i_row) {
+            if (matrix[i_row].size() != this->max_radial) {
+              std::stringstream err_str{};
+              err_str << "projection_matrices should have expanded_max_radial="
+                      << this->max_radial << " columns but "
+                      << matrix[i_row].size() << " were given.";
+              throw std::logic_error(err_str.str());
+            }
+            for (size_t i_col{0}; i_col < this->max_radial; ++i_col) {
+              projection(i_row, i_col) = matrix[i_row][i_col];
+            }
+          }
+          this->projections.emplace_back(projection * ortho_norm_matrix);
+        }
+        // only l=0 contributes to the center contribution
+        this->radial_integral_center =
+            this->projections.front() * this->radial_integral_center;
+      }
+
+      //! contract (and orthonormalize) the expanded radial integrals
+      Matrix_t project(const Matrix_t & expanded) const {
+        Matrix_t contracted(this->projections.front().rows(), expanded.cols());
+        for (int angular_l{0}; angular_l < expanded.cols(); ++angular_l) {
+          contracted.col(angular_l) =
+              this->projections[angular_l] * expanded.col(angular_l);
+        }
+        return contracted;
+      }
+
       void init_interpolator(const Hypers_t & hypers) {
         auto radial_contribution_hypers =
             hypers.at("radial_contribution").template get<json>();
@@ -1093,7 +1390,10 @@ namespace rascal {
         std::function<Matrix_t(double)> func{
             [&](const double distance) mutable {
               Parent::compute_neighbour_contribution(distance, this->fac_a);
-              return this->radial_integral_neighbour;
+              if (this->is_contracted) {
+                return this->project(this->radial_integral_neighbour);
+              }
+              return Matrix_t(this->radial_integral_neighbour);
             }};
         Matrix_t result = func(range_begin);
         int cols{static_cast<int>(result.cols())};
@@ -1140,6 +1440,10 @@ namespace rascal {
 
       double fac_a{};
       std::unique_ptr<Interpolator_t> intp{};
+      //! true if the radial basis is contracted with radial_basis_projection
+      bool is_contracted{false};
+      //! projections of each angular channel folded with the orthonormalization
+      std::vector<Eigen::MatrixXd> projections{};
     };
 
   }  // namespace internal
@@ -1231,15 +1535,42 @@ namespace rascal {
 
       this->max_radial = hypers.at("max_radial").get<size_t>();
       this->max_angular = hypers.at("max_angular").get<size_t>();
+      this->max_angular_per_radial =
+          internal::get_max_angular_per_radial(hypers);
+      this->n_radial_per_angular.assign(this->max_angular + 1, 0);
+      for (const auto & l_max : this->max_angular_per_radial) {
+        for (size_t angular_l{0}; angular_l < l_max + 1; ++angular_l) {
+          this->n_radial_per_angular[angular_l]++;
+        }
+      }
+      this->is_ragged = false;
+      for (const auto & l_max : this->max_angular_per_radial) {
+        if (l_max != this->max_angular) {
+          this->is_ragged = true;
+        }
+      }
       if (hypers.count("compute_gradients")) {
         this->compute_gradients = hypers.at("compute_gradients").get<bool>();
       } else {  // Default false (don't compute gradients)
         this->compute_gradients = false;
       }
 
+      // Default: the gradients are computed with respect to all the atoms
+      this->gradient_atoms.clear();
+      this->restrict_gradient_atoms = false;
+      if (hypers.count("gradient_atoms") and
+          not hypers.at("gradient_atoms").is_null()) {
+        auto gradient_atoms_tmp =
+            hypers.at("gradient_atoms").get<std::vector<int>>();
+        this->gradient_atoms.insert(gradient_atoms_tmp.begin(),
+                                    gradient_atoms_tmp.end());
+        this->restrict_gradient_atoms = true;
+      }
+
       if (hypers.count("expansion_by_species_method")) {
         std::set<std::string> possible_expansion_by_species{
-            {"environment wise", "user defined", "structure wise"}};
+            {"environment wise", "user defined", "structure wise",
+             "alchemical"}};
         auto expansion_by_species_tmp =
             hypers.at("expansion_by_species_method").get<std::string>();
         if (possible_expansion_by_species.count(expansion_by_species_tmp)) {
@@ -1265,15 +1596,23 @@ namespace rascal {
           this->global_species.insert({sp});
         }
       } else {
-        if (this->expansion_by_species == "user defined") {
+        if (this->expansion_by_species == "user defined" or
+            this->expansion_by_species == "alchemical") {
           std::stringstream err_str{};
-          err_str << "expansion_by_species_method is 'user defined'"
-                  << " but global_species is not defined.";
+          err_str << "expansion_by_species_method is '"
+                  << this->expansion_by_species
+                  << "' but global_species is not defined.";
           throw std::logic_error(err_str.str());
         }
         this->global_species.clear();
       }
 
+      this->species_coupling.resize(0, 0);
+      this->pseudo_species_keys.clear();
+      if (this->expansion_by_species == "alchemical") {
+        this->set_species_coupling(hypers);
+      }
+
       this->spherical_harmonics.precompute(this->max_angular,
                                            this->compute_gradients);
 
@@ -1348,6 +1687,12 @@ namespace rascal {
         this->optimization_type = OptimizationType::None;
       }
 
+      if (not internal::get_radial_basis_projection(hypers).is_null() and
+          this->optimization_type != OptimizationType::Interpolator) {
+        throw std::logic_error("radial_basis_projection requires the "
+                               "\'Spline\' optimization type.");
+      }
+
       switch (internal::combine_to_radial_contribution_type(
           this->radial_integral_type, this->atomic_smearing_type,
           this->optimization_type)) {
@@ -1411,6 +1756,23 @@ namespace rascal {
                                ": \'ShiftedCosine\' or 'RadialScaling'.");
       }
 
+      this->cache_pair_geometry = false;
+      if (hypers.count("cache_pair_geometry")) {
+        this->cache_pair_geometry =
+            hypers.at("cache_pair_geometry").get<bool>();
+      }
+      // the cutoff function values are shared by the calculators with the
+      // same cutoff function and the harmonics by the ones with the same
+      // max_angular and gradients, whatever their cutoff radius
+      this->pair_cutoff_function_name =
+          std::string("pair_cutoff_function_") + fc_hypers.dump();
+      json pair_harmonics_hypers{
+          {"max_angular", this->max_angular},
+          {"compute_gradients", this->compute_gradients}};
+      this->pair_harmonics_name =
+          std::string("pair_harmonics_") + pair_harmonics_hypers.dump();
+
+      this->set_backing_directory(hypers);
       this->set_name(hypers);
     }
 
@@ -1435,6 +1797,15 @@ namespace rascal {
      */
     bool does_gradients() const override { return this->compute_gradients; }
 
+    /**
+     * Are the gradients w.r.t. the position of the atom with this tag
+     * computed ? Only relevant when does_gradients() is true.
+     */
+    bool is_gradient_atom(int atom_tag) const {
+      return not this->restrict_gradient_atoms or
+             this->gradient_atoms.count(atom_tag);
+    }
+
     /**
      * Construct a new Calculator using a hyperparameters container
      *
@@ -1467,16 +1838,28 @@ namespace rascal {
           interpolator_accuracy{std::move(other.interpolator_accuracy)},
           max_radial{std::move(other.max_radial)}, max_angular{std::move(
                                                        other.max_angular)},
+          max_angular_per_radial{std::move(other.max_angular_per_radial)},
+          n_radial_per_angular{std::move(other.n_radial_per_angular)},
+          is_ragged{std::move(other.is_ragged)},
           compute_gradients{std::move(other.compute_gradients)},
+          restrict_gradient_atoms{std::move(other.restrict_gradient_atoms)},
+          gradient_atoms{std::move(other.gradient_atoms)},
           expansion_by_species{std::move(other.expansion_by_species)},
           global_species{std::move(other.global_species)},
+          species_coupling{std::move(other.species_coupling)},
+          pseudo_species_keys{std::move(other.pseudo_species_keys)},
           atomic_smearing_type{std::move(other.atomic_smearing_type)},
           radial_integral{std::move(other.radial_integral)},
           radial_integral_type{std::move(other.radial_integral_type)},
           optimization_type{std::move(other.optimization_type)},
           cutoff_function{std::move(other.cutoff_function)},
           cutoff_function_type{std::move(other.cutoff_function_type)},
-          spherical_harmonics{std::move(other.spherical_harmonics)} {}
+          spherical_harmonics{std::move(other.spherical_harmonics)},
+          cache_pair_geometry{std::move(other.cache_pair_geometry)},
+          pair_cutoff_function_name{
+              std::move(other.pair_cutoff_function_name)},
+          pair_harmonics_name{std::move(other.pair_harmonics_name)},
+          pair_list{std::move(other.pair_list)} {}
 
     //! Destructor
     virtual ~CalculatorSphericalExpansion() = default;
@@ -1538,6 +1921,43 @@ namespace rascal {
               internal::OptimizationType OptType, class StructureManager>
     void compute_impl(std::shared_ptr<StructureManager> manager);
 
+    /**
+     * Per pair quantities cached in the managers: either f_c(r_{ij}) and
+     * df_c(r_{ij})/dr_{ij}, or Y_l^m(\hat{r}_{ij}) followed, if the gradients
+     * are computed, by their (3, (l_max+1)^2) row-major gradients.
+     */
+    template <class StructureManager>
+    using PairGeometry_t =
+        Property<double, 2, StructureManager, Eigen::Dynamic, 1>;
+
+    /**
+     * Get the cutoff function values of the pairs of manager shared by the
+     * calculators with the same cutoff function, computing them if they are
+     * not up to date with the structure.
+     */
+    template <internal::CutoffFunctionType FcType, class StructureManager>
+    PairGeometry_t<StructureManager> &
+    get_pair_cutoff_function(std::shared_ptr<StructureManager> manager);
+
+    /**
+     * Get the spherical harmonics of the pairs of manager shared by the
+     * calculators with the same max_angular and gradients (e.g. the ones
+     * with different cutoff radii computed on the same neighbour list).
+     */
+    template <class StructureManager>
+    PairGeometry_t<StructureManager> &
+    get_pair_harmonics(std::shared_ptr<StructureManager> manager);
+
+    //! name of the pair cutoff function property in the managers
+    const std::string & get_pair_cutoff_function_name() const {
+      return this->pair_cutoff_function_name;
+    }
+
+    //! name of the pair spherical harmonics property in the managers
+    const std::string & get_pair_harmonics_name() const {
+      return this->pair_harmonics_name;
+    }
+
    protected:
     //! cutoff radius r_c defining the size of the atom centered environment
     double interaction_cutoff{};
@@ -1554,9 +1974,27 @@ namespace rascal {
      * l < max_angular + 1 are used (the +1 is to follow GAP's convention).
      */
     size_t max_angular{};
+    //! largest angular channel l_max(n) kept for each radial channel n
+    std::vector<size_t> max_angular_per_radial{};
+    //! number of radial channels n_max(l) kept for each angular channel l
+    std::vector<size_t> n_radial_per_angular{};
+    /**
+     * true if some l_max(n) < max_angular. The coefficients (and gradients)
+     * with l > l_max(n) are then zero, the storage keeps the
+     * max_radial x (max_angular+1)^2 shape.
+     */
+    bool is_ragged{false};
     //! controls the computation of the gradients of the expansion wrt. atomic
     //! positions
     bool compute_gradients{};
+    //! true if the gradients are only computed wrt. gradient_atoms
+    bool restrict_gradient_atoms{false};
+    /**
+     * indices of the atoms (within each structure) whose positional
+     * derivatives are computed when restrict_gradient_atoms is true. The
+     * gradient entries of the other centers are left empty.
+     */
+    std::set<int> gradient_atoms{};
     /**
      * defines the method to determine the set of species to use in the
      * expansion
@@ -1566,6 +2004,16 @@ namespace rascal {
     //! user defined species appearing in the expansion indexing
     std::set<Key_t> global_species{};
 
+    /**
+     * weights w_{a k} of the projection of species a (row, indexed by the
+     * atomic number) onto the pseudo species k (column). Only used when
+     * expansion_by_species is 'alchemical'.
+     */
+    Matrix_t species_coupling{};
+
+    //! keys {0}, {1}, ... of the pseudo species channels ('alchemical' only)
+    std::vector<Key_t> pseudo_species_keys{};
+
     internal::AtomicSmearingType atomic_smearing_type{};
 
     std::shared_ptr<internal::RadialContributionBase> radial_integral{};
@@ -1578,6 +2026,72 @@ namespace rascal {
 
     math::SphericalHarmonics spherical_harmonics{};
 
+    /**
+     * reuse the per pair cutoff function and spherical harmonics stored in the
+     * managers by (and for) the other calculators, see PairGeometry_t
+     */
+    bool cache_pair_geometry{false};
+    std::string pair_cutoff_function_name{};
+    std::string pair_harmonics_name{};
+    //! buffer for the pairs of the structure filling the pair geometry
+    FlatPairList pair_list{};
+
+    /**
+     * Zero the coefficients with l > l_max(n) of a ragged basis in all the
+     * blocks of coeffs. NDims is the number of Cartesian components stacked
+     * along the rows (1 for the coefficients, 3 for their gradients).
+     */
+    template <int NDims, class Coeffs>
+    void truncate_radial_channels(Coeffs & coefficients) const {
+      for (auto el : coefficients) {
+        auto && block = el.second;
+        const size_t n_rows{static_cast<size_t>(block.rows() / NDims)};
+        size_t l_block_idx{0};
+        for (size_t angular_l{0}; angular_l < this->max_angular + 1;
+             ++angular_l) {
+          const size_t l_block_size{2 * angular_l + 1};
+          const size_t n_radial{this->n_radial_per_angular[angular_l]};
+          for (int i_dim{0}; i_dim < NDims; ++i_dim) {
+            block
+                .block(i_dim * n_rows + n_radial, l_block_idx,
+                       n_rows - n_radial, l_block_size)
+                .setZero();
+          }
+          l_block_idx += l_block_size;
+        }
+      }
+    }
+
+    /**
+     * Empty the gradient keys of the centers whose positional derivatives are
+     * not requested, i.e. \grad_i c^{i} and \grad_i c^{j} for all the
+     * neighbours j of the centers i not in gradient_atoms, so that neither
+     * memory nor computation is spent on them.
+     *
+     * @param keys_list_grad gradient keys following the ordering of
+     * center.pairs_with_self_pair()
+     */
+    template <class StructureManager>
+    void restrict_gradient_keys(
+        std::shared_ptr<StructureManager> & manager,
+        std::vector<std::set<Key_t>> & keys_list_grad) const {
+      if (not this->restrict_gradient_atoms) {
+        return;
+      }
+      size_t i_grad{0};
+      for (auto center : manager) {
+        const bool is_gradient_center{
+            this->is_gradient_atom(center.get_atom_tag())};
+        for (auto neigh : center.pairs_with_self_pair()) {
+          (void)neigh;  // to avoid compiler warning
+          if (not is_gradient_center) {
+            keys_list_grad[i_grad].clear();
+          }
+          ++i_grad;
+        }
+      }
+    }
+
     /**
      * set up chemical keys of the expension so that only species appearing in
      * the environment are present and initialize coeffs to zero.
@@ -1627,6 +2141,90 @@ namespace rascal {
         Property_t<StructureManager> & expansions_coefficients,
         PropertyGradient_t<StructureManager> &
             expansions_coefficients_gradient);
+
+    /**
+     * Set up the keys of the pseudo species channels of the 'alchemical'
+     * expansion and initialize coeffs to zero.
+     * All the channels are used for the coefficients and for the gradients
+     * associated with pair_ii while the ones associated with pair_ij only
+     * contain the channels the species of the center couples to.
+     *
+     * @throw runtime_error when all the species of the structure are not
+     * present in global_species
+     */
+    template <class StructureManager>
+    void initialize_expansion_alchemical(
+        std::shared_ptr<StructureManager> & managers,
+        Property_t<StructureManager> & expansions_coefficients,
+        PropertyGradient_t<StructureManager> &
+            expansions_coefficients_gradient);
+
+    /**
+     * Parse the species_coupling hyper, a n_species x n_pseudo_species
+     * matrix whose rows follow the order of global_species.
+     *
+     * @throw logic_error if the matrix is missing or has inconsistent shape
+     */
+    void set_species_coupling(const Hypers_t & hypers) {
+      if (not hypers.count("species_coupling")) {
+        throw std::logic_error("expansion_by_species_method is 'alchemical'"
+                               " but species_coupling is not defined.");
+      }
+      auto species = hypers.at("global_species").get<Key_t>();
+      auto coupling = hypers.at("species_coupling")
+                          .get<std::vector<std::vector<double>>>();
+      if (coupling.size() != species.size() or coupling.size() == 0) {
+        std::stringstream err_str{};
+        err_str << "species_coupling should have one row per species in "
+                << "global_species: " << coupling.size() << " rows for "
+                << species.size() << " species.";
+        throw std::logic_error(err_str.str());
+      }
+      size_t n_pseudo_species{coupling.front().size()};
+      if (n_pseudo_species == 0) {
+        throw std::logic_error("species_coupling has no pseudo species.");
+      }
+      this->species_coupling = Matrix_t::Zero(MaxChemElements, n_pseudo_species);
+      for (size_t i_sp{0}; i_sp < species.size(); ++i_sp) {
+        const int & sp{species[i_sp]};
+        if (sp < 0 or sp >= MaxChemElements) {
+          std::stringstream err_str{};
+          err_str << "global_species contains an invalid species: " << sp;
+          throw std::logic_error(err_str.str());
+        }
+        if (coupling[i_sp].size() != n_pseudo_species) {
+          std::stringstream err_str{};
+          err_str << "species_coupling row " << i_sp << " has "
+                  << coupling[i_sp].size() << " entries instead of "
+                  << n_pseudo_species;
+          throw std::logic_error(err_str.str());
+        }
+        for (size_t i_pseudo{0}; i_pseudo < n_pseudo_species; ++i_pseudo) {
+          this->species_coupling(sp, i_pseudo) = coupling[i_sp][i_pseudo];
+        }
+      }
+      for (size_t i_pseudo{0}; i_pseudo < n_pseudo_species; ++i_pseudo) {
+        this->pseudo_species_keys.push_back({static_cast<int>(i_pseudo)});
+      }
+    }
+
+    /**
+     * Accumulate factor * w_{a k} * contribution into coefficients[{k}] for
+     * all the pseudo species k that species a couples to.
+     */
+    template <class Coefficients, class Derived>
+    void scatter_to_pseudo_species(
+        Coefficients & coefficients, const int & species,
+        const Eigen::MatrixBase<Derived> & contribution, double factor = 1.) {
+      for (size_t i_pseudo{0}; i_pseudo < this->pseudo_species_keys.size();
+           ++i_pseudo) {
+        const double weight{this->species_coupling(species, i_pseudo)};
+        if (weight != 0.) {
+          coefficients[this->pseudo_species_keys[i_pseudo]] +=
+              (factor * weight) * contribution;
+        }
+      }
+    }
   };
 
   // compute classes template construction
@@ -1720,6 +2318,68 @@ namespace rascal {
     }
   }  // namespace rascal
 
+  template <internal::CutoffFunctionType FcType, class StructureManager>
+  auto CalculatorSphericalExpansion::get_pair_cutoff_function(
+      std::shared_ptr<StructureManager> manager)
+      -> PairGeometry_t<StructureManager> & {
+    auto && pair_cutoff_function{
+        *manager->template get_property<PairGeometry_t<StructureManager>>(
+            this->pair_cutoff_function_name, true, true)};
+    // the status is reset when the structure changes
+    if (pair_cutoff_function.is_updated()) {
+      return pair_cutoff_function;
+    }
+    auto cutoff_function{
+        downcast_cutoff_function<FcType>(this->cutoff_function)};
+    pair_cutoff_function.clear();
+    pair_cutoff_function.set_nb_row(2);
+    pair_cutoff_function.resize();
+    this->pair_list.update(manager);
+    for (size_t i_pair{0}; i_pair < this->pair_list.size(); ++i_pair) {
+      const double & dist{this->pair_list.distances[i_pair]};
+      auto && values{
+          pair_cutoff_function[this->pair_list.pair_indices[i_pair]]};
+      values(0) = cutoff_function->f_c(dist);
+      values(1) = cutoff_function->df_c(dist);
+    }
+    pair_cutoff_function.set_updated_status(true);
+    return pair_cutoff_function;
+  }
+
+  template <class StructureManager>
+  auto CalculatorSphericalExpansion::get_pair_harmonics(
+      std::shared_ptr<StructureManager> manager)
+      -> PairGeometry_t<StructureManager> & {
+    auto && pair_harmonics{
+        *manager->template get_property<PairGeometry_t<StructureManager>>(
+            this->pair_harmonics_name, true, true)};
+    if (pair_harmonics.is_updated()) {
+      return pair_harmonics;
+    }
+    const Eigen::Index n_harmonics{static_cast<Eigen::Index>(
+        (this->max_angular + 1) * (this->max_angular + 1))};
+    pair_harmonics.clear();
+    pair_harmonics.set_nb_row((this->compute_gradients ? 1 + ThreeD : 1) *
+                              n_harmonics);
+    pair_harmonics.resize();
+    this->pair_list.update(manager);
+    const auto directions{this->pair_list.get_directions()};
+    for (size_t i_pair{0}; i_pair < this->pair_list.size(); ++i_pair) {
+      auto && harmonics{pair_harmonics[this->pair_list.pair_indices[i_pair]]};
+      this->spherical_harmonics.calc(directions.col(i_pair),
+                                     this->compute_gradients);
+      harmonics.head(n_harmonics) =
+          this->spherical_harmonics.get_harmonics().transpose();
+      if (this->compute_gradients) {
+        Eigen::Map<math::Matrix_t>(harmonics.data() + n_harmonics, ThreeD,
+                                   n_harmonics) =
+            this->spherical_harmonics.get_harmonics_derivatives();
+      }
+    }
+    pair_harmonics.set_updated_status(true);
+    return pair_harmonics;
+  }
+
   /**
    * Compute the spherical expansion
    */
@@ -1745,6 +2405,10 @@ namespace rascal {
       throw std::logic_error("Can't compute spherical expansion gradients with "
                              "masked center atoms");
     }
+    if (this->restrict_gradient_atoms and IsHalfNL and compute_gradients) {
+      throw std::logic_error("Can't restrict the gradients to gradient_atoms "
+                             "with a half neighbor list");
+    }
     if (not is_not_masked and IsHalfNL) {
       std::stringstream err_str{};
       err_str << "Half neighbor list should only be used when all the "
@@ -1785,6 +2449,13 @@ namespace rascal {
     if (expansions_coefficients.is_updated()) {
       return;
     }
+    expansions_coefficients.set_backing_directory(this->backing_directory);
+    instrumentation::ScopedTimer timer{"spherical expansion"};
+    instrumentation::add_count("spherical expansion centers", manager->size());
+    instrumentation::add_count("spherical expansion pairs",
+                               manager->get_nb_clusters(2));
+    expansions_coefficients_gradient.set_backing_directory(
+        this->backing_directory);
 
     // downcast cutoff and radial contributions so they are functional
     auto cutoff_function{
@@ -1815,12 +2486,67 @@ namespace rascal {
     } else if (this->expansion_by_species == "structure wise") {
       this->initialize_expansion_structure_wise(
           manager, expansions_coefficients, expansions_coefficients_gradient);
+    } else if (this->expansion_by_species == "alchemical") {
+      this->initialize_expansion_alchemical(
+          manager, expansions_coefficients, expansions_coefficients_gradient);
     } else {
       throw std::runtime_error("should not arrive here");
     }
 
+    // in the alchemical mode the contribution of an atom of species a is
+    // accumulated into the pseudo species channels k with weights w_{a k}
+    const bool is_alchemical{this->expansion_by_species == "alchemical"};
+
     // coeff C^{ij}_{nlm}
     auto c_ij_nlm = math::Matrix_t(n_row, n_col);
+    // grad_j C^{ij}_{nlm}
+    auto pair_gradient = math::Matrix_t(ThreeD * n_row, n_col);
+    // r_{ij} of the neighbours of the current center
+    Eigen::ArrayXd neighbour_distances{};
+
+    // With a ragged basis only the first n_max(l) radial channels of each
+    // angular channel are accumulated, the others stay zero. If the radial
+    // channels are mixed by finalize_coefficients() the full rectangle is
+    // accumulated and the truncation is applied to the final coefficients.
+    const bool truncate_after_finalize{
+        this->is_ragged and radial_integral->mixes_radial_channels()};
+    std::vector<size_t> n_radial_per_angular(this->max_angular + 1,
+                                             this->max_radial);
+    if (this->is_ragged and not truncate_after_finalize) {
+      n_radial_per_angular = this->n_radial_per_angular;
+    }
+    c_ij_nlm.setZero();
+    pair_gradient.setZero();
+
+    // with max_angular == 0 (e.g. for the RadialSpectrum) only the constant
+    // harmonic Y_0^0 contributes and its gradient vanishes, so the pair
+    // contributions are accumulated without evaluating the harmonics
+    const bool is_radial_only{this->max_angular == 0};
+    const double y_00{1. / std::sqrt(4.0 * PI)};
+
+    // pair quantities shared with the other calculators using the same
+    // neighbour list, see cache_pair_geometry
+    PairGeometry_t<StructureManager> * pair_cutoff_function{nullptr};
+    PairGeometry_t<StructureManager> * pair_harmonics{nullptr};
+    if (this->cache_pair_geometry) {
+      pair_cutoff_function =
+          &this->template get_pair_cutoff_function<FcType>(manager);
+      if (not is_radial_only) {
+        pair_harmonics = &this->get_pair_harmonics(manager);
+      }
+    }
+
+    // With a list sorted by distance (e.g. built for a larger cutoff shared
+    // by several calculators) the neighbours of a center beyond the
+    // interaction cutoff all come last. Their contributions vanish with the
+    // cutoff function anyway, so they are skipped.
+    const bool is_sorted_by_distance{internal::get_sorted_by_distance(
+                                         *manager) ==
+                                     AdaptorTraits::SortedByDistance::yes};
+    // Y_l^m(\hat{r}_{ij}) and their gradients (if computed) of the current
+    // pair
+    const double * harmonics_data{nullptr};
+    const double * harmonics_gradients_data{nullptr};
 
     for (auto center : manager) {
       // c^{i}
@@ -1830,61 +2556,130 @@ namespace rascal {
           expansions_coefficients_gradient[center.get_atom_ii()];
       auto atom_i_tag = center.get_atom_tag();
       Key_t center_type{center.get_atom_type()};
+      // \grad_i c^{i} and \grad_i c^{j} are only needed if the forces on i
+      // are requested
+      const bool compute_center_gradients{compute_gradients and
+                                          this->is_gradient_atom(atom_i_tag)};
 
       // Start the accumulation with the central atom contribution
-      coefficients_center[center_type].col(0) +=
-          radial_integral->template compute_center_contribution(center) /
-          sqrt(4.0 * PI);
+      auto && center_contribution{
+          radial_integral->template compute_center_contribution(center)};
+      if (is_alchemical) {
+        for (size_t i_pseudo{0}; i_pseudo < this->pseudo_species_keys.size();
+             ++i_pseudo) {
+          const double weight{this->species_coupling(center_type[0], i_pseudo)};
+          if (weight != 0.) {
+            coefficients_center[this->pseudo_species_keys[i_pseudo]].col(0) +=
+                weight * center_contribution / sqrt(4.0 * PI);
+          }
+        }
+      } else {
+        coefficients_center[center_type].col(0) +=
+            center_contribution / sqrt(4.0 * PI);
+      }
+
+      // evaluate the radial contributions of all the neighbours at once
+      // (the size of the proxy includes the self pair, if any)
+      neighbour_distances.resize(center.pairs().size());
+      size_t i_neigh{0};
+      for (auto neigh : center.pairs()) {
+        const double & dist{manager->get_distance(neigh)};
+        if (dist > this->interaction_cutoff) {
+          if (is_sorted_by_distance) {
+            break;
+          }
+          continue;
+        }
+        neighbour_distances(i_neigh) = dist;
+        ++i_neigh;
+      }
+      radial_integral->compute_neighbour_contributions(
+          neighbour_distances.head(i_neigh));
 
+      i_neigh = 0;
       for (auto neigh : center.pairs()) {
+        const double & dist{manager->get_distance(neigh)};
+        if (dist > this->interaction_cutoff) {
+          if (is_sorted_by_distance) {
+            break;
+          }
+          continue;
+        }
         auto atom_j = neigh.get_atom_j();
         const int atom_j_tag = atom_j.get_atom_tag();
         const bool is_center_atom{manager->is_center_atom(neigh)};
 
-        const double & dist{manager->get_distance(neigh)};
         const auto direction{manager->get_direction_vector(neigh)};
         Key_t neigh_type{neigh.get_atom_type()};
-        this->spherical_harmonics.calc(direction, compute_gradients);
-        auto && harmonics{spherical_harmonics.get_harmonics()};
-        auto && harmonics_gradients{
-            spherical_harmonics.get_harmonics_derivatives()};
 
         auto && neighbour_contribution =
-            radial_integral->template compute_neighbour_contribution(dist,
-                                                                     neigh);
-        double f_c{cutoff_function->f_c(dist)};
-        auto coefficients_center_by_type{coefficients_center[neigh_type]};
+            radial_integral->get_neighbour_contribution(i_neigh, neigh);
+        double f_c{}, df_c{};
+        if (pair_cutoff_function != nullptr) {
+          auto && values{(*pair_cutoff_function)[neigh]};
+          f_c = values(0);
+          df_c = values(1);
+        } else {
+          f_c = cutoff_function->f_c(dist);
+          if (compute_center_gradients) {
+            df_c = cutoff_function->df_c(dist);
+          }
+        }
+        if (pair_harmonics != nullptr) {
+          harmonics_data = (*pair_harmonics)[neigh].data();
+          harmonics_gradients_data = harmonics_data + n_col;
+        } else if (not is_radial_only) {
+          this->spherical_harmonics.calc(direction, compute_center_gradients);
+          harmonics_data = this->spherical_harmonics.get_harmonics().data();
+          harmonics_gradients_data =
+              this->spherical_harmonics.get_harmonics_derivatives().data();
+        }
 
         // compute the coefficients
         size_t l_block_idx{0};
-        for (size_t angular_l{0}; angular_l < this->max_angular + 1;
-             ++angular_l) {
-          size_t l_block_size{2 * angular_l + 1};
-          c_ij_nlm.block(0, l_block_idx, max_radial, l_block_size) =
-              neighbour_contribution.col(angular_l) *
-              harmonics.segment(l_block_idx, l_block_size);
-          l_block_idx += l_block_size;
+        if (is_radial_only) {
+          const size_t n_radial{n_radial_per_angular[0]};
+          c_ij_nlm.col(0).head(n_radial) =
+              (f_c * y_00) * neighbour_contribution.col(0).head(n_radial);
+        } else {
+          Eigen::Map<const math::Vector_t> harmonics(harmonics_data, n_col);
+          for (size_t angular_l{0}; angular_l < this->max_angular + 1;
+               ++angular_l) {
+            size_t l_block_size{2 * angular_l + 1};
+            const size_t n_radial{n_radial_per_angular[angular_l]};
+            c_ij_nlm.block(0, l_block_idx, n_radial, l_block_size) =
+                neighbour_contribution.col(angular_l).head(n_radial) *
+                harmonics.segment(l_block_idx, l_block_size);
+            l_block_idx += l_block_size;
+          }
+          c_ij_nlm *= f_c;
+        }
+        if (is_alchemical) {
+          this->scatter_to_pseudo_species(coefficients_center, neigh_type[0],
+                                          c_ij_nlm);
+        } else {
+          coefficients_center[neigh_type] += c_ij_nlm;
         }
-        c_ij_nlm *= f_c;
-        coefficients_center_by_type += c_ij_nlm;
 
         // half list branch for c^{ji} terms using
         // c^{ij}_{nlm} = (-1)^l c^{ji}_{nlm}.
         if (IsHalfNL) {
           if (is_center_atom) {
             auto & coefficients_neigh{expansions_coefficients[atom_j]};
-            auto coefficients_neigh_by_type{coefficients_neigh[center_type]};
             l_block_idx = 0;
-            double parity{1.};
             for (size_t angular_l{0}; angular_l < this->max_angular + 1;
                  ++angular_l) {
               size_t l_block_size{2 * angular_l + 1};
-              coefficients_neigh_by_type.block(0, l_block_idx, max_radial,
-                                               l_block_size) +=
-                  parity *
-                  c_ij_nlm.block(0, l_block_idx, max_radial, l_block_size);
+              if (angular_l % 2 == 1) {
+                c_ij_nlm.middleCols(l_block_idx, l_block_size) *= -1.;
+              }
               l_block_idx += l_block_size;
-              parity *= -1.;
+            }
+            if (is_alchemical) {
+              this->scatter_to_pseudo_species(coefficients_neigh,
+                                              center_type[0], c_ij_nlm);
+            } else {
+              coefficients_neigh[center_type] += c_ij_nlm;
             }
           }
         }
@@ -1894,75 +2689,97 @@ namespace rascal {
         // but only if the neighbour is _not_ an image of the center!
         // (the periodic images move with the center, so their contribution to
         // the center gradient is zero)
-        if (compute_gradients and (atom_j_tag != atom_i_tag)) {  // NOLINT
+        if (compute_center_gradients and (atom_j_tag != atom_i_tag)) {
           // \grad_i c^j
           auto & coefficients_neigh_gradient =
               expansions_coefficients_gradient[neigh];
 
           auto && neighbour_derivative =
-              radial_integral->compute_neighbour_derivative(dist, neigh);
-          double df_c{cutoff_function->df_c(dist)};
+              radial_integral->get_neighbour_derivative(i_neigh, neigh);
           // The type of the contribution c^{ij} to the coefficient c^{i}
           // depends on the type of j (and it is the same for the gradients)
           // In the following atom i is of type a and atom j is of type b
 
-          // grad_i c^{ib}
-          auto && gradient_center_by_type{
-              coefficients_center_gradient[neigh_type]};
-          // grad_i c^{ja}
-          auto && gradient_neigh_by_type{
-              coefficients_neigh_gradient[center_type]};
-
           // clang-format off
           // d/dr_{ij} (c_{ij} f_c{r_{ij}})
           Matrix_t pair_gradient_contribution_p1 =
                 ((neighbour_derivative * f_c)
                  + (neighbour_contribution * df_c));
-          // grad_j c^{ij}
-          Matrix_t pair_gradient_contribution{this->max_radial,
-                                              this->max_angular + 1};
-          for (int cartesian_idx{0}; cartesian_idx < ThreeD;
+          // grad_j c^{ij}, only the radial part contributes if
+          // is_radial_only
+          if (is_radial_only) {
+            const size_t n_radial{n_radial_per_angular[0]};
+            for (int cartesian_idx{0}; cartesian_idx < ThreeD;
                  ++cartesian_idx) {
-            l_block_idx = 0;
-            double parity{-1.};  // account for (-1)^{l+1}
-            for (size_t angular_l{0}; angular_l < this->max_angular + 1;
-                ++angular_l) {
-              size_t l_block_size{2 * angular_l + 1};
-              pair_gradient_contribution.resize(this->max_radial, l_block_size);
-              /*
-               pair_gradient_contribution_p1.col(angular_l)
-                * harmonics.segment(l_block_idx, l_block_size)
-               should be precomputed like pair_gradient_contribution_p1
-
-               the memory layout of pair_gradient_contribution_p1.col(angular_l)
-               is not the best one considering the access.
-               */
-              pair_gradient_contribution =
-                pair_gradient_contribution_p1.col(angular_l)
-                * harmonics.segment(l_block_idx, l_block_size)
-                * direction(cartesian_idx);
-              pair_gradient_contribution +=
-                  neighbour_contribution.col(angular_l)
-                  * harmonics_gradients.block(cartesian_idx, l_block_idx,
-                                              1, l_block_size)
-                  * f_c / dist;
-
-              // Each Cartesian gradient component occupies a contiguous block
-              // (row-major storage)
-              // grad_i c^{ib} = - \sum_{j} grad_j c^{ij}
-              gradient_center_by_type.block(
-                  cartesian_idx * max_radial, l_block_idx,
-                  max_radial, l_block_size) -= pair_gradient_contribution;
-              // grad_i c^{ja} = (-1)^{l+1} grad_j c^{ij}
-              gradient_neigh_by_type.block(
-                  cartesian_idx * max_radial, l_block_idx,
-                  max_radial, l_block_size) = parity *
-                    pair_gradient_contribution;
-              l_block_idx += l_block_size;
-              parity *= -1.;
-              // clang-format on
-            }  // for (angular_l)
-          }    // for cartesian_idx
+              pair_gradient.col(0).segment(cartesian_idx * max_radial,
+                                           n_radial) =
+                (y_00 * direction(cartesian_idx))
+                * pair_gradient_contribution_p1.col(0).head(n_radial);
+            }
+          } else {
+            Eigen::Map<const math::Vector_t> harmonics(harmonics_data, n_col);
+            Eigen::Map<const math::Matrix_t> harmonics_gradients(
+                harmonics_gradients_data, ThreeD, n_col);
+            for (int cartesian_idx{0}; cartesian_idx < ThreeD;
+                   ++cartesian_idx) {
+              l_block_idx = 0;
+              for (size_t angular_l{0}; angular_l < this->max_angular + 1;
+                  ++angular_l) {
+                size_t l_block_size{2 * angular_l + 1};
+                const size_t n_radial{n_radial_per_angular[angular_l]};
+                // Each Cartesian gradient component occupies a contiguous
+                // block (row-major storage)
+                auto pair_gradient_block = pair_gradient.block(
+                    cartesian_idx * max_radial, l_block_idx,
+                    n_radial, l_block_size);
+                /*
+                 pair_gradient_contribution_p1.col(angular_l)
+                  * harmonics.segment(l_block_idx, l_block_size)
+                 should be precomputed like pair_gradient_contribution_p1
+
+                 the memory layout of
+                 pair_gradient_contribution_p1.col(angular_l) is not the best
+                 one considering the access.
+                 */
+                pair_gradient_block =
+                  pair_gradient_contribution_p1.col(angular_l).head(n_radial)
+                  * harmonics.segment(l_block_idx, l_block_size)
+                  * direction(cartesian_idx);
+                pair_gradient_block +=
+                    neighbour_contribution.col(angular_l).head(n_radial)
+                    * harmonics_gradients.block(cartesian_idx, l_block_idx,
+                                                1, l_block_size)
+                    * f_c / dist;
+                l_block_idx += l_block_size;
+                // clang-format on
+              }  // for (angular_l)
+            }    // for cartesian_idx
+          }
+
+          // grad_i c^{ib} = - \sum_{j} grad_j c^{ij}
+          if (is_alchemical) {
+            this->scatter_to_pseudo_species(coefficients_center_gradient,
+                                            neigh_type[0], pair_gradient, -1.);
+          } else {
+            coefficients_center_gradient[neigh_type] -= pair_gradient;
+          }
+
+          // grad_i c^{ja} = (-1)^{l+1} grad_j c^{ij}
+          l_block_idx = 0;
+          for (size_t angular_l{0}; angular_l < this->max_angular + 1;
+               ++angular_l) {
+            size_t l_block_size{2 * angular_l + 1};
+            if (angular_l % 2 == 0) {
+              pair_gradient.middleCols(l_block_idx, l_block_size) *= -1.;
+            }
+            l_block_idx += l_block_size;
+          }
+          if (is_alchemical) {
+            this->scatter_to_pseudo_species(coefficients_neigh_gradient,
+                                            center_type[0], pair_gradient);
+          } else {
+            coefficients_neigh_gradient[center_type] = pair_gradient;
+          }
 
           // half list branch for accumulating parts of grad_j c^{j} using
           // grad_j c^{ji a} = - grad_i c^{ji a}
@@ -1972,14 +2789,19 @@ namespace rascal {
               auto & coefficients_neigh_center_gradient =
                   expansions_coefficients_gradient[neigh.get_atom_jj()];
               // grad_j c^{j a}
-              auto gradient_neigh_center_by_type =
-                  coefficients_neigh_center_gradient[center_type];
-
-              gradient_neigh_center_by_type -= gradient_neigh_by_type;
+              if (is_alchemical) {
+                this->scatter_to_pseudo_species(
+                    coefficients_neigh_center_gradient, center_type[0],
+                    pair_gradient, -1.);
+              } else {
+                coefficients_neigh_center_gradient[center_type] -=
+                    pair_gradient;
+              }
             }  // if (is_center_atom)
           }    // if (IsHalfNL)
         }      // if (compute_gradients)
-      }        // for (neigh : center)
+        ++i_neigh;
+      }  // for (neigh : center)
 
       // In the case of having several periodic images of other centers in
       // the environment of center i, we need to sum up
@@ -1987,7 +2809,7 @@ namespace rascal {
       // j primes are periodic images of j. And assign this sum back to all
       // of these terms.
       if (not IsHalfNL) {
-        if (compute_gradients) {
+        if (compute_center_gradients) {
           // sum of d/dr_{i} C^{ji}_{nlm} when center j has several periodic
           // images of center i in its environment
           auto di_c_ji_sum = math::Matrix_t(n_row, n_col);
@@ -2000,17 +2822,20 @@ namespace rascal {
           // contributions and assign the sum back to the terms
           for (const auto & el : periodic_images_of_center) {
             const auto & p_images = el.second;
-            // these terms have only one species key that is non zero
-            Key_t key{
-                expansions_coefficients_gradient[p_images.at(0)].get_keys().at(
-                    0)};
-            di_c_ji_sum = expansions_coefficients_gradient[p_images[0]][key];
-            for (auto image_it = p_images.begin() + 1, im_e = p_images.end();
-                 image_it != im_e; ++image_it) {
-              di_c_ji_sum += expansions_coefficients_gradient[*image_it][key];
-            }
-            for (const auto & p_image : el.second) {
-              expansions_coefficients_gradient[p_image][key] = di_c_ji_sum;
+            // these terms have only the species keys of the center that are
+            // non zero (a single one unless the expansion is 'alchemical')
+            for (const auto & key :
+                 expansions_coefficients_gradient[p_images.at(0)].get_keys()) {
+              di_c_ji_sum = expansions_coefficients_gradient[p_images[0]][key];
+              for (auto image_it = p_images.begin() + 1,
+                        im_e = p_images.end();
+                   image_it != im_e; ++image_it) {
+                di_c_ji_sum +=
+                    expansions_coefficients_gradient[*image_it][key];
+              }
+              for (const auto & p_image : el.second) {
+                expansions_coefficients_gradient[p_image][key] = di_c_ji_sum;
+              }
             }
           }  // end of periodic images business
         }    // if (compute_gradients)
@@ -2018,11 +2843,22 @@ namespace rascal {
 
       // Normalize and orthogonalize the radial coefficients
       radial_integral->finalize_coefficients(coefficients_center);
-      if (compute_gradients) {
+      if (compute_center_gradients) {
         radial_integral->template finalize_coefficients_der<ThreeD>(
             expansions_coefficients_gradient, center);
       }
+      if (truncate_after_finalize) {
+        this->truncate_radial_channels<1>(coefficients_center);
+        if (compute_center_gradients) {
+          for (auto neigh : center.pairs_with_self_pair()) {
+            this->truncate_radial_channels<ThreeD>(
+                expansions_coefficients_gradient[neigh]);
+          }
+        }
+      }
     }  // for (center : manager)
+    expansions_coefficients.set_updated_status(true);
+    expansions_coefficients_gradient.set_updated_status(true);
   }    // compute()
 
   template <class StructureManager>
@@ -2084,6 +2920,7 @@ namespace rascal {
     expansions_coefficients.setZero();
 
     if (compute_gradients) {
+      this->restrict_gradient_keys(manager, keys_list_grad);
       expansions_coefficients_gradient.resize(keys_list_grad);
       expansions_coefficients_gradient.setZero();
     } else {
@@ -2107,12 +2944,10 @@ namespace rascal {
       }
     }
 
-    std::vector<std::set<Key_t>> keys_list{};
     std::vector<std::set<Key_t>> keys_list_grad{};
     for (auto center : manager) {
       Key_t center_type{center.get_atom_type()};
       auto atom_i_tag = center.get_atom_tag();
-      keys_list.emplace_back(keys);
       if (this->compute_gradients) {
         keys_list_grad.emplace_back(keys);
         for (auto neigh : center.pairs()) {
@@ -2127,10 +2962,12 @@ namespace rascal {
       }
     }
 
-    expansions_coefficients.resize(keys_list);
+    // every center gets the keys of the whole structure
+    expansions_coefficients.resize(keys);
     expansions_coefficients.setZero();
 
     if (this->compute_gradients) {
+      this->restrict_gradient_keys(manager, keys_list_grad);
       expansions_coefficients_gradient.resize(keys_list_grad);
       expansions_coefficients_gradient.setZero();
     } else {
@@ -2143,7 +2980,6 @@ namespace rascal {
       std::shared_ptr<StructureManager> & manager,
       Property_t<StructureManager> & expansions_coefficients,
       PropertyGradient_t<StructureManager> & expansions_coefficients_gradient) {
-    std::vector<std::set<Key_t>> keys_list{};
     std::vector<std::set<Key_t>> keys_list_grad{};
 
     // check that all species in the structure are present in global_species
@@ -2171,7 +3007,6 @@ namespace rascal {
     // build the species list
     for (auto center : manager) {
       Key_t center_type{center.get_atom_type()};
-      keys_list.emplace_back(this->global_species);
       if (this->compute_gradients) {
         keys_list_grad.emplace_back(this->global_species);
         auto atom_i_tag = center.get_atom_tag();
@@ -2187,10 +3022,86 @@ namespace rascal {
       }
     }
 
+    // every center has the keys of global_species, so the coefficients are
+    // stored as a dense matrix without any per center key set
+    expansions_coefficients.resize(this->global_species);
+    expansions_coefficients.setZero();
+
+    if (this->compute_gradients) {
+      this->restrict_gradient_keys(manager, keys_list_grad);
+      expansions_coefficients_gradient.resize(keys_list_grad);
+      expansions_coefficients_gradient.setZero();
+    } else {
+      expansions_coefficients_gradient.resize();
+    }
+  }
+
+  template <class StructureManager>
+  void CalculatorSphericalExpansion::initialize_expansion_alchemical(
+      std::shared_ptr<StructureManager> & manager,
+      Property_t<StructureManager> & expansions_coefficients,
+      PropertyGradient_t<StructureManager> & expansions_coefficients_gradient) {
+    std::vector<std::set<Key_t>> keys_list{};
+    std::vector<std::set<Key_t>> keys_list_grad{};
+
+    // check that all species in the structure are present in global_species,
+    // neighbours included since they would silently not contribute otherwise
+    std::set<int> missing_keys{};
+    for (auto center : manager) {
+      if (not internal::is_element_in(center.get_atom_type(),
+                                      this->global_species)) {
+        missing_keys.insert(center.get_atom_type());
+      }
+      for (auto neigh : center.pairs()) {
+        if (not internal::is_element_in(neigh.get_atom_type(),
+                                        this->global_species)) {
+          missing_keys.insert(neigh.get_atom_type());
+        }
+      }
+    }
+    if (missing_keys.size() > 0) {
+      std::stringstream err_str{};
+      err_str << "global_species is missing at least these species: '";
+      for (const auto & key : missing_keys) {
+        err_str << key << ", ";
+      }
+      err_str << "'.";
+      throw std::runtime_error(err_str.str());
+    }
+
+    std::set<Key_t> pseudo_species{this->pseudo_species_keys.begin(),
+                                   this->pseudo_species_keys.end()};
+    // build the pseudo species list
+    for (auto center : manager) {
+      const int center_type{center.get_atom_type()};
+      keys_list.emplace_back(pseudo_species);
+      if (this->compute_gradients) {
+        keys_list_grad.emplace_back(pseudo_species);
+        std::set<Key_t> center_channels{};
+        for (size_t i_pseudo{0}; i_pseudo < this->pseudo_species_keys.size();
+             ++i_pseudo) {
+          if (this->species_coupling(center_type, i_pseudo) != 0.) {
+            center_channels.insert(this->pseudo_species_keys[i_pseudo]);
+          }
+        }
+        auto atom_i_tag = center.get_atom_tag();
+        for (auto neigh : center.pairs()) {
+          auto && atom_j = neigh.get_atom_j();
+          auto atom_j_tag = atom_j.get_atom_tag();
+          if (atom_j_tag != atom_i_tag) {
+            keys_list_grad.emplace_back(center_channels);
+          } else {
+            keys_list_grad.emplace_back();
+          }
+        }
+      }
+    }
+
     expansions_coefficients.resize(keys_list);
     expansions_coefficients.setZero();
 
     if (this->compute_gradients) {
+      this->restrict_gradient_keys(manager, keys_list_grad);
       expansions_coefficients_gradient.resize(keys_list_grad);
       expansions_coefficients_gradient.setZero();
     } else {
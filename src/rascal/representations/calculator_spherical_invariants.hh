@@ -31,19 +31,20 @@
 #ifndef SRC_RASCAL_REPRESENTATIONS_CALCULATOR_SPHERICAL_INVARIANTS_HH_
 #define SRC_RASCAL_REPRESENTATIONS_CALCULATOR_SPHERICAL_INVARIANTS_HH_
 
+#include "rascal/math/clebsch_gordan.hh"
 #include "rascal/math/utils.hh"
 #include "rascal/representations/calculator_base.hh"
 #include "rascal/representations/calculator_spherical_expansion.hh"
 #include "rascal/structure_managers/property_block_sparse.hh"
 #include "rascal/structure_managers/structure_manager.hh"
+#include "rascal/utils/instrumentation.hh"
 #include "rascal/utils/utils.hh"
 
-#include <wigxjpf.h>
-
 #include <Eigen/Dense>
 #include <Eigen/Eigenvalues>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <exception>
 #include <unordered_set>
@@ -68,80 +69,210 @@ namespace rascal {
       return l_factors;
     }
 
-    //! Wigner pre-factors
-    inline Eigen::ArrayXd precompute_wigner_w3js(size_t max_angular,
-                                                 bool inversion_symmetry) {
-      Eigen::ArrayXd wigner_w3js{};
-      // get the number of non zero elements in the w3j
-      int n_elements{0};
-      for (size_t l1{0}; l1 < max_angular + 1; ++l1) {
-        for (size_t l2{0}; l2 < max_angular + 1; ++l2) {
-          for (size_t l3{0}; l3 < max_angular + 1; ++l3) {
-            if ((l1 < static_cast<size_t>(std::abs<int>(l2 - l3))) ||
-                (l1 > l2 + l3)) {
-              continue;
-            }
-            if (inversion_symmetry) {
-              if ((l1 + l2 + l3) % 2 == 1) {
-                continue;
-              }
-            }
-            for (size_t m1{0}; m1 < 2 * l1 + 1; m1++) {
-              int m1s{static_cast<int>(m1 - l1)};
-              for (size_t m2{0}; m2 < 2 * l2 + 1; m2++) {
-                int m2s{static_cast<int>(m2 - l2)};
-                for (size_t m3{0}; m3 < 2 * l3 + 1; m3++) {
-                  int m3s{static_cast<int>(m3 - l3)};
-                  if (m1s + m2s + m3s != 0) {
-                    continue;
-                  }
-                  ++n_elements;
-                }
-              }
-            }
+    using PowerSpectrumLView_t =
+        Eigen::Map<math::Matrix_t, 0,
+                   Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>>;
+
+    /**
+     * View of the p_{n_1 n_2 l} at fixed l of a (full basis) power spectrum
+     * block, stored row-major with rows (n_1 n_2) and columns l, as a
+     * (n_rows, max_radial) matrix indexed by (n_1, n_2). For a gradient block
+     * n_rows = 3 * max_radial since its rows are (x n_1 n_2) with x the
+     * Cartesian direction.
+     */
+    inline PowerSpectrumLView_t
+    get_powerspectrum_l_view(double * data, size_t l, size_t n_rows,
+                             size_t max_radial, size_t max_angular) {
+      const size_t n_cols{max_angular + 1};
+      return PowerSpectrumLView_t(
+          data + l, n_rows, max_radial,
+          Eigen::Stride<Eigen::Dynamic, Eigen::Dynamic>(max_radial * n_cols,
+                                                        n_cols));
+    }
+
+    /**
+     * Contractions of the full basis power spectrum of one species pair and
+     * of its gradient with the size of the basis fixed at compile time. The
+     * products at fixed l then only involve fixed size Eigen types and the
+     * loop over l is unrolled. PowerSpectrumKernel<Eigen::Dynamic,
+     * Eigen::Dynamic> handles any basis size.
+     */
+    template <int MaxRadial, int MaxAngular>
+    class PowerSpectrumKernel {
+     public:
+      static constexpr int NL{MaxAngular + 1};
+      static constexpr int NCoefs{NL * NL};
+      using Coefficients_t = Eigen::Map<
+          const Eigen::Matrix<double, MaxRadial, NCoefs, Eigen::RowMajor>>;
+      using GradCoefficients_t = Eigen::Map<const Eigen::Matrix<
+          double, ThreeD * MaxRadial, NCoefs, Eigen::RowMajor>>;
+      //! fixed size version of PowerSpectrumLView_t
+      template <int NRows>
+      using LView_t =
+          Eigen::Map<Eigen::Matrix<double, NRows, MaxRadial, Eigen::RowMajor>,
+                     0, Eigen::Stride<MaxRadial * NL, NL>>;
+
+      PowerSpectrumKernel(size_t /*max_radial*/, size_t /*max_angular*/) {}
+
+      /**
+       * Set the power spectrum block soap_vector to
+       * factor * l_factors(l) * c^1_{n_1 l} . c^2_{n_2 l}
+       */
+      void compute(const math::Matrix_Ref & coef1,
+                   const math::Matrix_Ref & coef2,
+                   const Eigen::VectorXd & l_factors, double factor,
+                   double * soap_vector) {
+        this->compute_l(Coefficients_t(coef1.data()),
+                        Coefficients_t(coef2.data()), l_factors, factor,
+                        soap_vector, std::integral_constant<int, 0>{});
+      }
+
+      /**
+       * Add factor * l_factors(l) * \grad c^1_{n_1 l} . c^2_{n_2 l} to the
+       * gradient block soap_gradient, with rows (x n_1 n_2), if add_direct
+       * and the same with n_1 and n_2 swapped if add_swapped.
+       */
+      void add_gradient(const math::Matrix_Ref & grad_coef1,
+                        const math::Matrix_Ref & coef2,
+                        const Eigen::VectorXd & l_factors, double factor,
+                        bool add_direct, bool add_swapped,
+                        double * soap_gradient) {
+        this->add_gradient_l(GradCoefficients_t(grad_coef1.data()),
+                             Coefficients_t(coef2.data()), l_factors, factor,
+                             add_direct, add_swapped, soap_gradient,
+                             std::integral_constant<int, 0>{});
+      }
+
+     protected:
+      template <int L>
+      void compute_l(const Coefficients_t & coef1,
+                     const Coefficients_t & coef2,
+                     const Eigen::VectorXd & l_factors, double factor,
+                     double * soap_vector, std::integral_constant<int, L>) {
+        constexpr int LBlockIdx{L * L}, LBlockSize{2 * L + 1};
+        LView_t<MaxRadial>(soap_vector + L).noalias() =
+            (factor * l_factors(L)) *
+            (coef1.template middleCols<LBlockSize>(LBlockIdx) *
+             coef2.template middleCols<LBlockSize>(LBlockIdx).transpose());
+        this->compute_l(coef1, coef2, l_factors, factor, soap_vector,
+                        std::integral_constant<int, L + 1>{});
+      }
+
+      //! end of the loop over l
+      void compute_l(const Coefficients_t &, const Coefficients_t &,
+                     const Eigen::VectorXd &, double, double *,
+                     std::integral_constant<int, NL>) {}
+
+      template <int L>
+      void add_gradient_l(const GradCoefficients_t & grad_coef1,
+                          const Coefficients_t & coef2,
+                          const Eigen::VectorXd & l_factors, double factor,
+                          bool add_direct, bool add_swapped,
+                          double * soap_gradient,
+                          std::integral_constant<int, L>) {
+        constexpr int LBlockIdx{L * L}, LBlockSize{2 * L + 1};
+        // (\grad c^1_l) (c^2_l)^T with rows (x n_1)
+        const Eigen::Matrix<double, ThreeD * MaxRadial, MaxRadial,
+                            Eigen::RowMajor>
+            soap_gradient_l{
+                (factor * l_factors(L)) *
+                (grad_coef1.template middleCols<LBlockSize>(LBlockIdx) *
+                 coef2.template middleCols<LBlockSize>(LBlockIdx)
+                     .transpose())};
+        if (add_direct) {
+          LView_t<ThreeD * MaxRadial>(soap_gradient + L) += soap_gradient_l;
+        }
+        if (add_swapped) {
+          constexpr int NBlock{MaxRadial * MaxRadial * NL};
+          for (int cartesian_idx{0}; cartesian_idx < ThreeD; ++cartesian_idx) {
+            LView_t<MaxRadial>(soap_gradient + cartesian_idx * NBlock + L) +=
+                soap_gradient_l
+                    .template middleRows<MaxRadial>(cartesian_idx * MaxRadial)
+                    .transpose();
           }
         }
+        this->add_gradient_l(grad_coef1, coef2, l_factors, factor, add_direct,
+                             add_swapped, soap_gradient,
+                             std::integral_constant<int, L + 1>{});
       }
 
-      wigner_w3js.resize(n_elements);
-      n_elements = 0;
-      wig_table_init(2 * (max_angular + 1), 3);
-      wig_temp_init(2 * (max_angular + 1));
-      for (size_t l1{0}; l1 < max_angular + 1; ++l1) {
-        for (size_t l2{0}; l2 < max_angular + 1; ++l2) {
-          for (size_t l3{0}; l3 < max_angular + 1; ++l3) {
-            if ((l1 < static_cast<size_t>(std::abs<int>(l2 - l3))) ||
-                (l1 > l2 + l3)) {
-              continue;
-            }
-            if (inversion_symmetry) {
-              if ((l1 + l2 + l3) % 2 == 1) {
-                continue;
-              }
-            }
-            for (size_t m1{0}; m1 < 2 * l1 + 1; m1++) {
-              int m1s{static_cast<int>(m1 - l1)};
-              for (size_t m2{0}; m2 < 2 * l2 + 1; m2++) {
-                int m2s{static_cast<int>(m2 - l2)};
-                for (size_t m3{0}; m3 < 2 * l3 + 1; m3++) {
-                  int m3s{static_cast<int>(m3 - l3)};
-                  if (m1s + m2s + m3s != 0) {
-                    continue;
-                  }
-                  wigner_w3js(n_elements) =
-                      wig3jj(2 * l1, 2 * l2, 2 * l3, 2 * m1s, 2 * m2s, 2 * m3s);
-                  ++n_elements;
-                }
-              }
+      //! end of the loop over l
+      void add_gradient_l(const GradCoefficients_t &, const Coefficients_t &,
+                          const Eigen::VectorXd &, double, bool, bool,
+                          double *, std::integral_constant<int, NL>) {}
+    };
+
+    //! generic PowerSpectrumKernel, with runtime basis sizes
+    template <>
+    class PowerSpectrumKernel<Eigen::Dynamic, Eigen::Dynamic> {
+     public:
+      PowerSpectrumKernel(size_t max_radial, size_t max_angular)
+          : max_radial{max_radial}, max_angular{max_angular},
+            soap_vector_l(max_radial, max_radial),
+            soap_gradient_l(ThreeD * max_radial, max_radial) {}
+
+      //! see PowerSpectrumKernel::compute
+      void compute(const math::Matrix_Ref & coef1,
+                   const math::Matrix_Ref & coef2,
+                   const Eigen::VectorXd & l_factors, double factor,
+                   double * soap_vector) {
+        // p^{ab}_{n_1 n_2 l} = c^a_{n_1 l} (c^b_{n_2 l})^T for all
+        // (n_1, n_2) at once
+        for (size_t l{0}; l < this->max_angular + 1; ++l) {
+          const size_t l_block_idx{l * l}, l_block_size{2 * l + 1};
+          this->soap_vector_l.noalias() =
+              coef1.middleCols(l_block_idx, l_block_size) *
+              coef2.middleCols(l_block_idx, l_block_size).transpose();
+          get_powerspectrum_l_view(soap_vector, l, this->max_radial,
+                                   this->max_radial, this->max_angular) =
+              (factor * l_factors(l)) * this->soap_vector_l;
+        }
+      }
+
+      //! see PowerSpectrumKernel::add_gradient
+      void add_gradient(const math::Matrix_Ref & grad_coef1,
+                        const math::Matrix_Ref & coef2,
+                        const Eigen::VectorXd & l_factors, double factor,
+                        bool add_direct, bool add_swapped,
+                        double * soap_gradient) {
+        const size_t n_block{this->max_radial * this->max_radial *
+                             (this->max_angular + 1)};
+        for (size_t l{0}; l < this->max_angular + 1; ++l) {
+          const size_t l_block_idx{l * l}, l_block_size{2 * l + 1};
+          const double l_factor{factor * l_factors(l)};
+          // (\grad c^1_l) (c^2_l)^T with rows (x n_1)
+          this->soap_gradient_l.noalias() =
+              grad_coef1.middleCols(l_block_idx, l_block_size) *
+              coef2.middleCols(l_block_idx, l_block_size).transpose();
+          if (add_direct) {
+            get_powerspectrum_l_view(soap_gradient, l,
+                                     ThreeD * this->max_radial,
+                                     this->max_radial, this->max_angular) +=
+                l_factor * this->soap_gradient_l;
+          }
+          if (add_swapped) {
+            for (int cartesian_idx{0}; cartesian_idx < ThreeD;
+                 ++cartesian_idx) {
+              get_powerspectrum_l_view(
+                  soap_gradient + cartesian_idx * n_block, l,
+                  this->max_radial, this->max_radial, this->max_angular) +=
+                  l_factor * this->soap_gradient_l
+                                 .middleRows(cartesian_idx * this->max_radial,
+                                             this->max_radial)
+                                 .transpose();
             }
           }
         }
       }
-      wig_temp_free();
-      wig_table_free();
 
-      return wigner_w3js;
-    }
+     protected:
+      size_t max_radial;
+      size_t max_angular;
+      //! buffer for the p_{n_1 n_2 l} at fixed l
+      math::Matrix_t soap_vector_l;
+      //! and for their gradients, with rows (x n_1)
+      math::Matrix_t soap_gradient_l;
+    };
   }  // namespace internal
 
   class CalculatorSphericalInvariants : public CalculatorBase {
@@ -187,6 +318,16 @@ namespace rascal {
           coeff_indices_map{other.coeff_indices_map}, key_map{other.key_map},
           coeff_indices{other.coeff_indices},
           is_sparsified{other.is_sparsified},
+          sparsified_key{other.sparsified_key},
+          sparse_species_ids{std::move(other.sparse_species_ids)},
+          n_sparse_species{other.n_sparse_species},
+          sparse_coeff_indices{std::move(other.sparse_coeff_indices)},
+          sparse_coeff_ranges{std::move(other.sparse_coeff_ranges)},
+          is_projected{other.is_projected},
+          projection_matrices{std::move(other.projection_matrices)},
+          projection_species_ids{std::move(other.projection_species_ids)},
+          n_projection_species{other.n_projection_species},
+          projection_ids{std::move(other.projection_ids)},
           max_radial{std::move(other.max_radial)}, max_angular{std::move(
                                                        other.max_angular)},
           inner_invariants_shape{std::move(other.inner_invariants_shape)},
@@ -195,7 +336,7 @@ namespace rascal {
           inversion_symmetry{std::move(other.inversion_symmetry)},
           rep_expansion{std::move(other.rep_expansion)},
           type{std::move(other.type)}, l_factors{std::move(other.l_factors)},
-          wigner_w3js{std::move(other.wigner_w3js)} {}
+          bispectrum_couplings{std::move(other.bispectrum_couplings)} {}
     //! Destructor
     virtual ~CalculatorSphericalInvariants() = default;
 
@@ -253,6 +394,66 @@ namespace rascal {
     //! tell if the calculator has been sparsified using
     //! the coefficient_subselection input
     bool is_sparsified{false};
+    //! key of the powerspectrum when using coefficient_subselection
+    internal::SortedKey<Key_t> sparsified_key{};
+    //! compact id of the species present in unique_pair_list (-1 otherwise)
+    std::vector<int> sparse_species_ids{};
+    //! number of species present in unique_pair_list
+    size_t n_sparse_species{0};
+    //! content of coeff_indices_map stored contiguously in key order
+    std::vector<PowerSpectrumCoeffIndex> sparse_coeff_indices{};
+    //! [begin, end) of the coefficients of each pair of compact species ids
+    //! in sparse_coeff_indices
+    std::vector<std::array<size_t, 2>> sparse_coeff_ranges{};
+
+    //! tell if the powerspectrum is projected with power_spectrum_projection
+    bool is_projected{false};
+    //! projections W^{ab} of the powerspectrum of each species pair
+    std::vector<math::Matrix_t> projection_matrices{};
+    //! compact id of the species of power_spectrum_projection (-1 otherwise)
+    std::vector<int> projection_species_ids{};
+    //! number of species in power_spectrum_projection
+    size_t n_projection_species{0};
+    //! index in projection_matrices of each pair of compact species ids
+    std::vector<int> projection_ids{};
+
+    //! contiguous range of PowerSpectrumCoeffIndex
+    struct PowerSpectrumCoeffIndexRange {
+      const PowerSpectrumCoeffIndex * first;
+      const PowerSpectrumCoeffIndex * last;
+      const PowerSpectrumCoeffIndex * begin() const { return this->first; }
+      const PowerSpectrumCoeffIndex * end() const { return this->last; }
+    };
+
+    /**
+     * Coefficients of the powerspectrum to compute for a (sorted) species
+     * pair. Only array indexing is involved so that it can be used in the
+     * inner loops of compute_impl in place of coeff_indices_map.
+     */
+    PowerSpectrumCoeffIndexRange
+    get_coeff_indices(const internal::SortedKey<Key_t> & spair) const {
+      if (not this->is_sparsified) {
+        return {this->coeff_indices.data(),
+                this->coeff_indices.data() + this->coeff_indices.size()};
+      }
+      const auto & sp_ids{this->sparse_species_ids};
+      const int sp1{spair.data[0]}, sp2{spair.data[1]};
+      if (sp1 < 0 or sp2 < 0 or sp1 >= static_cast<int>(sp_ids.size()) or
+          sp2 >= static_cast<int>(sp_ids.size()) or sp_ids[sp1] < 0 or
+          sp_ids[sp2] < 0) {
+        return {nullptr, nullptr};
+      }
+      const auto & range{this->sparse_coeff_ranges[static_cast<size_t>(
+          sp_ids[sp1] * this->n_sparse_species + sp_ids[sp2])]};
+      const PowerSpectrumCoeffIndex * data{this->sparse_coeff_indices.data()};
+      return {data + range[0], data + range[1]};
+    }
+
+    //! key of the powerspectrum block holding the species pair spair
+    const internal::SortedKey<Key_t> &
+    get_powerspectrum_key(const internal::SortedKey<Key_t> & spair) const {
+      return this->is_sparsified ? this->sparsified_key : spair;
+    }
 
     void set_hyperparameters(const Hypers_t & hypers) override {
       using internal::SphericalInvariantsType;
@@ -279,7 +480,7 @@ namespace rascal {
       } else if (soap_type == "BiSpectrum") {
         this->type = internal::SphericalInvariantsType::BiSpectrum;
         this->inversion_symmetry = hypers.at("inversion_symmetry").get<bool>();
-        this->wigner_w3js = internal::precompute_wigner_w3js(
+        this->bispectrum_couplings.precompute_bispectrum(
             this->max_angular, this->inversion_symmetry);
       } else {
         throw std::logic_error(
@@ -288,6 +489,7 @@ namespace rascal {
             ": 'PowerSpectrum', 'RadialSpectrum', or 'BiSpectrum'.");
       }
 
+      this->set_backing_directory(hypers);
       this->set_name(hypers);
     }
 
@@ -311,8 +513,17 @@ namespace rascal {
     void set_hyperparameters_powerspectrum(const Hypers_t & hypers) {
       using internal::SphericalInvariantsType;
       this->type = SphericalInvariantsType::PowerSpectrum;
+      // the coefficients c_{nlm} with l > l_max(n) of a ragged expansion are
+      // zero so the corresponding p_{n_1 n_2 l} are not computed
+      auto max_angular_per_radial{
+          internal::get_max_angular_per_radial(hypers)};
 
       if (hypers.find("coefficient_subselection") != hypers.end()) {
+        if (hypers.find("power_spectrum_projection") != hypers.end()) {
+          throw std::logic_error("coefficient_subselection and "
+                                 "power_spectrum_projection can not be used "
+                                 "together");
+        }
         this->is_sparsified = true;
         auto coefficient_subselection =
             hypers.at("coefficient_subselection").get<json>();
@@ -412,6 +623,10 @@ namespace rascal {
 
         // fill coeff_indices_map
         for (size_t i_pair{0}; i_pair < sp_a.size(); ++i_pair) {
+          if (angular_l[i_pair] > max_angular_per_radial[radial_n1[i_pair]] or
+              angular_l[i_pair] > max_angular_per_radial[radial_n2[i_pair]]) {
+            continue;
+          }
           Key_t pair{{sp_a[i_pair], sp_b[i_pair]}};
           internal::SortedKey<Key_t> spair{is_sorted, pair};
           // insertion order n1, n2, l, n1n2, l_block_size, l_block_idx
@@ -424,10 +639,45 @@ namespace rascal {
               this->l_factors[angular_l[i_pair]]);
         }
 
+        // dense version of coeff_indices_map indexed by compact species ids
+        this->sparse_species_ids.assign(MaxChemElements, -1);
+        this->n_sparse_species = 0;
+        for (const auto & key : this->unique_pair_list) {
+          for (const auto & sp : key.data) {
+            if (sp < 0 or sp >= MaxChemElements) {
+              std::stringstream err_str{};
+              err_str << "species " << sp << " in coefficient_subselection"
+                      << " should be in [0, " << MaxChemElements << ")";
+              throw std::runtime_error(err_str.str());
+            }
+            if (this->sparse_species_ids[sp] < 0) {
+              this->sparse_species_ids[sp] =
+                  static_cast<int>(this->n_sparse_species++);
+            }
+          }
+        }
+        this->sparse_coeff_indices.clear();
+        this->sparse_coeff_ranges.assign(
+            this->n_sparse_species * this->n_sparse_species, {{0, 0}});
+        for (const auto & el : this->coeff_indices_map) {
+          const size_t id1(this->sparse_species_ids[el.first.data[0]]),
+              id2(this->sparse_species_ids[el.first.data[1]]);
+          const size_t first{this->sparse_coeff_indices.size()};
+          this->sparse_coeff_indices.insert(this->sparse_coeff_indices.end(),
+                                            el.second.begin(), el.second.end());
+          const std::array<size_t, 2> range{
+              {first, this->sparse_coeff_indices.size()}};
+          this->sparse_coeff_ranges[id1 * this->n_sparse_species + id2] = range;
+          this->sparse_coeff_ranges[id2 * this->n_sparse_species + id1] = range;
+        }
+
         Key_t sparsified_type{0, 0};
-        // there are 118 atomic elements atm
-        for (int sp1{1}; sp1 < MaxChemElements; sp1++) {
-          for (int sp2{1}; sp2 < MaxChemElements; sp2++) {
+        this->sparsified_key = internal::SortedKey<Key_t>{is_sorted,
+                                                          sparsified_type};
+        // there are 118 atomic elements atm and 0 is the first pseudo species
+        // of an 'alchemical' expansion
+        for (int sp1{0}; sp1 < MaxChemElements; sp1++) {
+          for (int sp2{0}; sp2 < MaxChemElements; sp2++) {
             if (sp1 <= sp2) {
               Key_t pair_type{sp1, sp2};
               internal::SortedKey<Key_t> spair_type{is_sorted, pair_type};
@@ -446,7 +696,9 @@ namespace rascal {
         for (size_t n1{0}; n1 < this->max_radial; ++n1) {
           for (size_t n2{0}; n2 < this->max_radial; ++n2) {
             size_t pos{0};
-            for (size_t l{0}; l < this->max_angular + 1; ++l) {
+            const size_t l_max{std::min(max_angular_per_radial[n1],
+                                        max_angular_per_radial[n2])};
+            for (size_t l{0}; l < l_max + 1; ++l) {
               size_t size{2 * l + 1};
               this->coeff_indices.emplace_back(n1, n2, l,
                                                n1 * this->max_radial + n2, size,
@@ -456,9 +708,10 @@ namespace rascal {
           }
         }
         internal::Sorted<true> is_sorted{};
-        // there are 118 atomic elements atm
-        for (int sp1{1}; sp1 < MaxChemElements; sp1++) {
-          for (int sp2{1}; sp2 < MaxChemElements; sp2++) {
+        // there are 118 atomic elements atm and 0 is the first pseudo species
+        // of an 'alchemical' expansion
+        for (int sp1{0}; sp1 < MaxChemElements; sp1++) {
+          for (int sp2{0}; sp2 < MaxChemElements; sp2++) {
             if (sp1 <= sp2) {
               Key_t pair_type{sp1, sp2};
               internal::SortedKey<Key_t> spair_type{is_sorted, pair_type};
@@ -466,7 +719,112 @@ namespace rascal {
             }
           }
         }
+        this->set_hyperparameters_projection(hypers);
+      }
+    }
+
+    /**
+     * Read the optional per species pair projections W^{ab} of the
+     * powerspectrum. The projected features W^{ab} p^{ab}, with p^{ab} the
+     * (n_1 n_2 l) flattened powerspectrum of the species pair (a, b), are
+     * computed on the fly so that only them are stored.
+     */
+    void set_hyperparameters_projection(const Hypers_t & hypers) {
+      this->is_projected = false;
+      this->projection_matrices.clear();
+      this->projection_ids.clear();
+      this->projection_species_ids.clear();
+      if (hypers.find("power_spectrum_projection") == hypers.end()) {
+        return;
+      }
+      const auto & projection_hypers{hypers.at("power_spectrum_projection")};
+      auto species_pairs{projection_hypers.at("species_pairs")
+                             .template get<std::vector<std::array<int, 2>>>()};
+      auto matrices{projection_hypers.at("projection_matrices")
+                        .template get<std::vector<std::vector<
+                            std::vector<double>>>>()};
+      if (species_pairs.size() != matrices.size()) {
+        std::stringstream err_str{};
+        err_str << "power_spectrum_projection has " << species_pairs.size()
+                << " species_pairs but " << matrices.size()
+                << " projection_matrices";
+        throw std::logic_error(err_str.str());
+      }
+      const size_t n_features{this->inner_invariants_shape[0] *
+                              this->inner_invariants_shape[1]};
+      size_t n_projected{0};
+      this->projection_species_ids.assign(MaxChemElements, -1);
+      size_t n_species{0};
+      for (size_t i_pair{0}; i_pair < species_pairs.size(); ++i_pair) {
+        const auto & matrix{matrices[i_pair]};
+        if (i_pair == 0) {
+          n_projected = matrix.size();
+        }
+        if (matrix.size() != n_projected or matrix.empty()) {
+          throw std::logic_error("the projection_matrices of "
+                                 "power_spectrum_projection should have the "
+                                 "same, non zero, number of rows");
+        }
+        math::Matrix_t projection(n_projected, n_features);
+        for (size_t i_row{0}; i_row < n_projected; ++i_row) {
+          if (matrix[i_row].size() != n_features) {
+            std::stringstream err_str{};
+            err_str << "the projection_matrices of power_spectrum_projection"
+                    << " should have max_radial^2 * (max_angular + 1) = "
+                    << n_features << " columns but got "
+                    << matrix[i_row].size();
+            throw std::logic_error(err_str.str());
+          }
+          for (size_t i_col{0}; i_col < n_features; ++i_col) {
+            projection(i_row, i_col) = matrix[i_row][i_col];
+          }
+        }
+        this->projection_matrices.push_back(std::move(projection));
+        for (const auto & sp : species_pairs[i_pair]) {
+          if (sp < 0 or sp >= MaxChemElements) {
+            std::stringstream err_str{};
+            err_str << "species " << sp << " in power_spectrum_projection"
+                    << " should be in [0, " << MaxChemElements << ")";
+            throw std::logic_error(err_str.str());
+          }
+          if (this->projection_species_ids[sp] < 0) {
+            this->projection_species_ids[sp] = static_cast<int>(n_species++);
+          }
+        }
       }
+      this->n_projection_species = n_species;
+      this->projection_ids.assign(n_species * n_species, -1);
+      for (size_t i_pair{0}; i_pair < species_pairs.size(); ++i_pair) {
+        const auto & species_pair{species_pairs[i_pair]};
+        const size_t id1(this->projection_species_ids[species_pair[0]]),
+            id2(this->projection_species_ids[species_pair[1]]);
+        this->projection_ids[id1 * n_species + id2] = static_cast<int>(i_pair);
+        this->projection_ids[id2 * n_species + id1] = static_cast<int>(i_pair);
+      }
+      this->is_projected = true;
+      this->inner_invariants_shape[0] = 1;
+      this->inner_invariants_shape[1] = n_projected;
+    }
+
+    //! projection W^{ab} of the (sorted) species pair spair
+    const math::Matrix_t &
+    get_projection(const internal::SortedKey<Key_t> & spair) const {
+      const auto & sp_ids{this->projection_species_ids};
+      const int sp1{spair.data[0]}, sp2{spair.data[1]};
+      int id{-1};
+      if (sp1 >= 0 and sp2 >= 0 and sp1 < static_cast<int>(sp_ids.size()) and
+          sp2 < static_cast<int>(sp_ids.size()) and sp_ids[sp1] >= 0 and
+          sp_ids[sp2] >= 0) {
+        id = this->projection_ids[static_cast<size_t>(
+            sp_ids[sp1] * this->n_projection_species + sp_ids[sp2])];
+      }
+      if (id < 0) {
+        std::stringstream err_str{};
+        err_str << "power_spectrum_projection has no projection for the "
+                << "species pair (" << sp1 << ", " << sp2 << ")";
+        throw std::runtime_error(err_str.str());
+      }
+      return this->projection_matrices[id];
     }
 
     bool operator==(const CalculatorSphericalInvariants & other) const {
@@ -478,7 +836,7 @@ namespace rascal {
           this->inversion_symmetry == other.inversion_symmetry and
           this->type == other.type and
           (this->l_factors.array() == other.l_factors.array()).all() and
-          (this->wigner_w3js.array() == other.wigner_w3js.array()).all()};
+          this->bispectrum_couplings == other.bispectrum_couplings};
       bool rep_expansion_match{this->rep_expansion == other.rep_expansion};
       bool sparsification_match{
           this->unique_pair_list == other.unique_pair_list and
@@ -486,8 +844,20 @@ namespace rascal {
           this->key_map == other.key_map and
           this->coeff_indices == other.coeff_indices and
           this->is_sparsified == other.is_sparsified};
+      bool projection_match{this->is_projected == other.is_projected and
+                            this->projection_ids == other.projection_ids and
+                            this->projection_species_ids ==
+                                other.projection_species_ids and
+                            this->projection_matrices.size() ==
+                                other.projection_matrices.size()};
+      for (size_t i_proj{0}; projection_match and
+                             i_proj < this->projection_matrices.size();
+           ++i_proj) {
+        projection_match = (this->projection_matrices[i_proj] ==
+                            other.projection_matrices[i_proj]);
+      }
       return (grad_match and main_hypers_match and rep_expansion_match and
-              sparsification_match);
+              sparsification_match and projection_match);
     }
 
     /**
@@ -549,6 +919,13 @@ namespace rascal {
               class StructureManager>
     void compute_impl(std::shared_ptr<StructureManager> manager);
 
+    /**
+     * compute representation @f$ \nu == 2 @f$ with the full basis
+     * contractions of Kernel, a PowerSpectrumKernel
+     */
+    template <class Kernel, class StructureManager>
+    void compute_powerspectrum(std::shared_ptr<StructureManager> manager);
+
     //! compute representation @f$ \nu == 3 @f$
     template <internal::SphericalInvariantsType BodyOrder,
               std::enable_if_t<
@@ -557,12 +934,45 @@ namespace rascal {
               class StructureManager>
     void compute_impl(std::shared_ptr<StructureManager> manager);
 
+    /**
+     * Computes the spherical expansion the invariants are built from. It is
+     * attached to the manager as a transient property, unless it was already
+     * attached (e.g. computed by the user), so that release_expansion frees
+     * it once the invariants are computed.
+     */
+    template <class StructureManager>
+    void compute_expansion(std::shared_ptr<StructureManager> manager) {
+      using PropExp_t =
+          typename CalculatorSphericalExpansion::Property_t<StructureManager>;
+      using PropGradExp_t =
+          typename CalculatorSphericalExpansion::PropertyGradient_t<
+              StructureManager>;
+      constexpr bool ExcludeGhosts{true};
+      manager->template get_property<PropExp_t>(
+          this->rep_expansion.get_name(), true, true, ExcludeGhosts,
+          "no metadata", PropertyLifetime::Transient);
+      manager->template get_property<PropGradExp_t>(
+          this->rep_expansion.get_gradient_name(), true, true, false,
+          "no metadata", PropertyLifetime::Transient);
+      this->rep_expansion.compute(manager);
+    }
+
+    //! drops the expansion from the manager if it is transient
+    template <class StructureManager>
+    void release_expansion(std::shared_ptr<StructureManager> manager) {
+      manager->release_transient_property(this->rep_expansion.get_name());
+      manager->release_transient_property(
+          this->rep_expansion.get_gradient_name());
+    }
+
     //! initialize the soap vectors with only the keys needed for each center
     template <class StructureManager, class Invariants,
-              class InvariantsDerivative, class ExpansionCoeff>
+              class InvariantsDerivative, class ExpansionCoeff,
+              class ExpansionCoeffDerivative>
     void initialize_per_center_powerspectrum_soap_vectors(
         Invariants & soap_vector, InvariantsDerivative & soap_vector_gradients,
         ExpansionCoeff & expansions_coefficients,
+        ExpansionCoeffDerivative & expansions_coefficients_gradient,
         std::shared_ptr<StructureManager> manager);
 
     template <class StructureManager, class Invariants,
@@ -670,8 +1080,8 @@ namespace rascal {
     //! precomputed l-factors the PowerSpectrum
     Eigen::VectorXd l_factors{};
 
-    //! precomputed wigner symbols for the BiSpectrum
-    Eigen::ArrayXd wigner_w3js{};
+    //! non zero Clebsch-Gordan couplings of the BiSpectrum
+    math::SparseClebschGordan bispectrum_couplings{};
   };
 
   template <class StructureManager>
@@ -700,6 +1110,28 @@ namespace rascal {
       class StructureManager>
   void CalculatorSphericalInvariants::compute_impl(
       std::shared_ptr<StructureManager> manager) {
+    using internal::PowerSpectrumKernel;
+    // the full basis contractions of the commonly used basis sizes are
+    // specialized at compile time
+    if (not this->is_sparsified) {
+      if (this->max_radial == 6 and this->max_angular == 4) {
+        this->compute_powerspectrum<PowerSpectrumKernel<6, 4>>(manager);
+        return;
+      } else if (this->max_radial == 8 and this->max_angular == 6) {
+        this->compute_powerspectrum<PowerSpectrumKernel<8, 6>>(manager);
+        return;
+      } else if (this->max_radial == 12 and this->max_angular == 9) {
+        this->compute_powerspectrum<PowerSpectrumKernel<12, 9>>(manager);
+        return;
+      }
+    }
+    this->compute_powerspectrum<
+        PowerSpectrumKernel<Eigen::Dynamic, Eigen::Dynamic>>(manager);
+  }
+
+  template <class Kernel, class StructureManager>
+  void CalculatorSphericalInvariants::compute_powerspectrum(
+      std::shared_ptr<StructureManager> manager) {
     using PropExp_t =
         typename CalculatorSphericalExpansion::Property_t<StructureManager>;
     using PropGradExp_t =
@@ -709,18 +1141,7 @@ namespace rascal {
     using PropGrad_t = PropertyGradient_t<StructureManager>;
     using internal::SphericalInvariantsType;
     using math::pow;
-
-    // Compute the spherical expansions of the current structure
-    rep_expansion.compute(manager);
-
     constexpr bool ExcludeGhosts{true};
-    auto && expansions_coefficients{*manager->template get_property<PropExp_t>(
-        rep_expansion.get_name(), true, true, ExcludeGhosts)};
-
-    // No error if gradients not computed; just an empty array in that case
-    auto && expansions_coefficients_gradient{
-        *manager->template get_property<PropGradExp_t>(
-            rep_expansion.get_gradient_name(), true, true)};
 
     auto && soap_vectors{*manager->template get_property<Prop_t>(
         this->get_name(), true, true, ExcludeGhosts)};
@@ -733,9 +1154,26 @@ namespace rascal {
     if (soap_vectors.is_updated()) {
       return;
     }
+    soap_vectors.set_backing_directory(this->backing_directory);
+    soap_vector_gradients.set_backing_directory(this->backing_directory);
+    instrumentation::ScopedTimer timer{"spherical invariants"};
+    instrumentation::add_count("spherical invariants centers",
+                               manager->size());
+
+    // Compute the spherical expansions of the current structure
+    this->compute_expansion(manager);
+
+    auto && expansions_coefficients{*manager->template get_property<PropExp_t>(
+        rep_expansion.get_name(), true, true, ExcludeGhosts)};
+
+    // No error if gradients not computed; just an empty array in that case
+    auto && expansions_coefficients_gradient{
+        *manager->template get_property<PropGradExp_t>(
+            rep_expansion.get_gradient_name(), true, true)};
 
     this->initialize_per_center_powerspectrum_soap_vectors(
-        soap_vectors, soap_vector_gradients, expansions_coefficients, manager);
+        soap_vectors, soap_vector_gradients, expansions_coefficients,
+        expansions_coefficients_gradient, manager);
 
     Key_t pair_type{0, 0};
     // use special container to tell that there is not need to sort when
@@ -747,6 +1185,17 @@ namespace rascal {
         *manager, "power spectrums inverse norms", true};
     soap_vector_norm_inv.resize();
 
+    // contractions of the full basis case
+    Kernel kernel{this->max_radial, this->max_angular};
+    // full (n_1 n_2, l) powerspectrum block of one species pair and its
+    // gradient before their projection
+    const size_t n_full_rows{this->max_radial * this->max_radial};
+    math::Matrix_t soap_vector_full{}, soap_gradient_full{};
+    if (this->is_projected) {
+      soap_vector_full.resize(n_full_rows, this->max_angular + 1);
+      soap_gradient_full.resize(ThreeD * n_full_rows, this->max_angular + 1);
+    }
+
     for (auto center : manager) {
       auto & coefficients{expansions_coefficients[center]};
       auto & soap_vector{soap_vectors[center]};
@@ -763,9 +1212,27 @@ namespace rascal {
 
           spair_type[1] = el2.first[0];
           auto & coef2{el2.second};
-          auto && soap_vector_by_pair{soap_vector[this->key_map[spair_type]]};
-          const auto & coef_ids{coeff_indices_map[spair_type]};
-          for (const auto & coef_idx : coef_ids) {
+          auto && soap_vector_by_pair{
+              soap_vector[this->get_powerspectrum_key(spair_type)]};
+          // the \sqrt(2) factor to account for the missing (b,a) components
+          const double pair_factor{
+              spair_type[0] < spair_type[1] ? math::SQRT_TWO : 1.};
+          if (not this->is_sparsified) {
+            double * soap_vector_full_data{this->is_projected
+                                               ? soap_vector_full.data()
+                                               : soap_vector_by_pair.data()};
+            kernel.compute(coef1, coef2, this->l_factors, pair_factor,
+                           soap_vector_full_data);
+            if (this->is_projected) {
+              soap_vector_by_pair.row(0).noalias() =
+                  (this->get_projection(spair_type) *
+                   Eigen::Map<const Eigen::VectorXd>(soap_vector_full.data(),
+                                                     soap_vector_full.size()))
+                      .transpose();
+            }
+            continue;
+          }
+          for (const auto & coef_idx : this->get_coeff_indices(spair_type)) {
             // the Powerspectrum coefficient and
             // multiply with the constant 1 / \sqrt(2l+1)
             soap_vector_by_pair(coef_idx.n1n2, coef_idx.l) =
@@ -778,14 +1245,7 @@ namespace rascal {
                             coef_idx.l_block_size)
                      .array())
                     .sum() *
-                coef_idx.l_factor;
-          }
-
-          // the \sqrt(2) factor to account for the missing (b,a) components
-          if (spair_type[0] < spair_type[1]) {
-            for (const auto & coef_idx : coef_ids) {
-              soap_vector_by_pair(coef_idx.n1n2, coef_idx.l) *= math::SQRT_TWO;
-            }
+                coef_idx.l_factor * pair_factor;
           }
         }  // for el1 : coefficients
       }    // for el2 : coefficients
@@ -796,9 +1256,9 @@ namespace rascal {
         soap_vector_norm_inv[center] = norm_inv;
       }
 
-      if (this->compute_gradients) {
-        const int atom_i_tag{center.get_atom_tag()};
-
+      const int atom_i_tag{center.get_atom_tag()};
+      if (this->compute_gradients and
+          this->rep_expansion.is_gradient_atom(atom_i_tag)) {
         // Sum the gradients wrt the neighbour atom position
         // compute the \grad_i p^{k} coeffs where k is either i or j
         for (auto neigh : center.pairs_with_self_pair()) {
@@ -813,31 +1273,26 @@ namespace rascal {
           }
           // c^{k}
           auto & coefficients_j{expansions_coefficients[atom_j]};
-          std::vector<Key_t> keys_coef_j{coefficients_j.get_keys()};
           // \grad_i c^{k}
           auto & grad_neigh_coefficients{
               expansions_coefficients_gradient[neigh]};
-          std::vector<Key_t> keys_coef_grad_neigh{
-              grad_neigh_coefficients.get_keys()};
           // \grad_i p^{k}
           auto & soap_neigh_gradient{soap_vector_gradients[neigh]};
 
-          std::set<internal::SortedKey<Key_t>, internal::CompareSortedKeyLess>
-              grad_neigh_keys{};
           // \grad_i p^{kab} = \grad_i c^{k a} c^{k b} + c^{k a} \grad_i c^{k b}
           // by definition \grad_i c^{k a} is non zero for one key 'a' so
           // either a == b and we compute one term with a factor of 2 or only
           // one of the two terms is non zero hence the swap of entry when
           // spair_type[0] > spair_type[1] == true
-          for (const auto & coef_key_1 : keys_coef_grad_neigh) {
+          for (const auto & el1 : grad_neigh_coefficients) {
+            const auto & coef_key_1{el1.first};
             // \grad_i c^{k a}
-            const auto & grad_neigh_coefficients_1{
-                grad_neigh_coefficients[coef_key_1]};
+            const auto & grad_neigh_coefficients_1{el1.second};
 
-            for (const auto & coef_key_2 : keys_coef_j) {
+            for (const auto & el2 : coefficients_j) {
+              const auto & coef_key_2{el2.first};
               // c^{k b}
-              const auto & expansion_coefficients_j_2{
-                  coefficients_j[coef_key_2]};
+              const auto & expansion_coefficients_j_2{el2.second};
               bool sorted{true}, equal{false};
               // make sure spair_type has sorted entries
               if (coef_key_1[0] > coef_key_2[0]) {
@@ -853,11 +1308,47 @@ namespace rascal {
                 spair_type[1] = coef_key_2[0];
               }
 
-              grad_neigh_keys.insert(spair_type);
               // \grad_i p^{k ab}
               auto soap_neigh_gradient_by_species_pair{
-                  soap_neigh_gradient[this->key_map[spair_type]]};
-              const auto & coef_ids{coeff_indices_map[spair_type]};
+                  soap_neigh_gradient[this->get_powerspectrum_key(
+                      spair_type)]};
+              // \sqrt(2) factor to account for the missing (b,a) components
+              const double pair_factor{
+                  spair_type[0] < spair_type[1] ? math::SQRT_TWO : 1.};
+
+              if (not this->is_sparsified) {
+                double * soap_gradient_full_data{
+                    soap_neigh_gradient_by_species_pair.data()};
+                if (this->is_projected) {
+                  soap_gradient_full.setZero();
+                  soap_gradient_full_data = soap_gradient_full.data();
+                }
+                // same contractions as below but for all (x, n_1, n_2) at
+                // once:
+                // \grad_i c^{k a}_{n_1} c^{k b}_{n_2} if sorted or equal
+                // c^{k a}_{n_1} \grad_i c^{k b}_{n_2} if not sorted or equal
+                kernel.add_gradient(grad_neigh_coefficients_1,
+                                    expansion_coefficients_j_2,
+                                    this->l_factors, pair_factor,
+                                    sorted or equal, not sorted or equal,
+                                    soap_gradient_full_data);
+                if (this->is_projected) {
+                  const auto & projection{this->get_projection(spair_type)};
+                  const Eigen::Index n_full{soap_vector_full.size()};
+                  for (int cartesian_idx{0}; cartesian_idx < ThreeD;
+                       ++cartesian_idx) {
+                    soap_neigh_gradient_by_species_pair.row(cartesian_idx) +=
+                        (projection *
+                         Eigen::Map<const Eigen::VectorXd>(
+                             soap_gradient_full.data() + cartesian_idx * n_full,
+                             n_full))
+                            .transpose();
+                  }
+                }
+                continue;
+              }
+
+              const auto coef_ids{this->get_coeff_indices(spair_type)};
 
               // computes  \grad_i c^{k a}_{n_1} c^{k b}_{n_2}
               if (sorted or equal) {
@@ -878,7 +1369,7 @@ namespace rascal {
                        expansion_coefficients_j_2.block(
                           coef_idx.n2, coef_idx.l_block_idx,
                           1,  coef_idx.l_block_size).array()).sum()
-                      * coef_idx.l_factor;
+                      * coef_idx.l_factor * pair_factor;
                     // clang-format on
                   }  // for const auto& coef_idx : coef_ids
                 }    // for cartesian_idx
@@ -903,34 +1394,14 @@ namespace rascal {
                        expansion_coefficients_j_2.block(
                             coef_idx.n1, coef_idx.l_block_idx,
                             1, coef_idx.l_block_size).array()).sum()
-                      * coef_idx.l_factor;
+                      * coef_idx.l_factor * pair_factor;
                     // clang-format on
                   }  // for const auto& coef_idx : coef_ids
                 }    // for cartesian_idx
               }      // if (not sorted or equal)
             }        // keys_coef_j
           }          // keys_coef_grad_neigh
-
-          // multiply with \sqrt(2) factor to account
-          // for the missing (b,a) components
-          for (const auto & key : grad_neigh_keys) {
-            if (key[0] != key[1]) {
-              auto soap_neigh_gradient_by_species_pair{
-                  soap_neigh_gradient[this->key_map[key]]};
-              const auto & coef_ids{coeff_indices_map[key]};
-              for (size_t cartesian_idx{0}; cartesian_idx < 3;
-                   ++cartesian_idx) {
-                const size_t cartesian_offset_n1n2{
-                    cartesian_idx * this->inner_invariants_shape[0]};
-                for (const auto & coef_idx : coef_ids) {
-                  soap_neigh_gradient_by_species_pair(
-                      coef_idx.n1n2 + cartesian_offset_n1n2, coef_idx.l) *=
-                      math::SQRT_TWO;
-                }
-              }
-            }
-          }
-        }  // for neigh : center
+        }            // for neigh : center
       }    // if compute gradients
     }      // for center : manager
 
@@ -941,6 +1412,9 @@ namespace rascal {
           soap_vectors, soap_vector_gradients, manager, soap_vector_norm_inv,
           grad_component_size);
     }  // if normalize and compute_gradients
+    soap_vectors.set_updated_status(true);
+    soap_vector_gradients.set_updated_status(true);
+    this->release_expansion(manager);
   }    // compute_powerspectrum()
 
   template <
@@ -960,15 +1434,6 @@ namespace rascal {
     using math::pow;
     constexpr bool ExcludeGhosts{true};
 
-    rep_expansion.compute(manager);
-
-    auto && expansions_coefficients{*manager->template get_property<PropExp_t>(
-        rep_expansion.get_name(), true, true, ExcludeGhosts)};
-
-    auto & expansions_coefficients_gradient{
-        *manager->template get_property<PropGradExp_t>(
-            rep_expansion.get_gradient_name(), true, true)};
-
     auto && soap_vectors{*manager->template get_property<Prop_t>(
         this->get_name(), true, true, ExcludeGhosts)};
 
@@ -979,6 +1444,20 @@ namespace rascal {
     if (soap_vectors.is_updated()) {
       return;
     }
+    soap_vectors.set_backing_directory(this->backing_directory);
+    soap_vector_gradients.set_backing_directory(this->backing_directory);
+    instrumentation::ScopedTimer timer{"spherical invariants"};
+    instrumentation::add_count("spherical invariants centers",
+                               manager->size());
+
+    this->compute_expansion(manager);
+
+    auto && expansions_coefficients{*manager->template get_property<PropExp_t>(
+        rep_expansion.get_name(), true, true, ExcludeGhosts)};
+
+    auto & expansions_coefficients_gradient{
+        *manager->template get_property<PropGradExp_t>(
+            rep_expansion.get_gradient_name(), true, true)};
 
     this->initialize_per_center_radialspectrum_soap_vectors(
         soap_vectors, soap_vector_gradients, expansions_coefficients, manager);
@@ -1003,7 +1482,8 @@ namespace rascal {
         soap_vector_norm_inv[center] = norm_inv;
       }
 
-      if (this->compute_gradients) {
+      if (this->compute_gradients and
+          this->rep_expansion.is_gradient_atom(center.get_atom_tag())) {
         for (auto neigh : center.pairs_with_self_pair()) {
           auto && grad_neigh_coefficients{
               expansions_coefficients_gradient[neigh]};
@@ -1021,6 +1501,9 @@ namespace rascal {
           soap_vectors, soap_vector_gradients, manager, soap_vector_norm_inv,
           this->max_radial);
     }  // if (this->normalize and this->compute_gradients)
+    soap_vectors.set_updated_status(true);
+    soap_vector_gradients.set_updated_status(true);
+    this->release_expansion(manager);
   }
 
   template <
@@ -1035,12 +1518,7 @@ namespace rascal {
     using Prop_t = Property_t<StructureManager>;
     using internal::SphericalInvariantsType;
     using math::pow;
-
-    rep_expansion.compute(manager);
-
     constexpr bool ExcludeGhosts{true};
-    auto && expansions_coefficients{*manager->template get_property<PropExp_t>(
-        rep_expansion.get_name(), true, true, ExcludeGhosts)};
 
     auto && soap_vectors{*manager->template get_property<Prop_t>(
         this->get_name(), true, true, ExcludeGhosts)};
@@ -1050,11 +1528,23 @@ namespace rascal {
     if (soap_vectors.is_updated()) {
       return;
     }
+    soap_vectors.set_backing_directory(this->backing_directory);
+    instrumentation::ScopedTimer timer{"spherical invariants"};
+    instrumentation::add_count("spherical invariants centers",
+                               manager->size());
+
+    this->compute_expansion(manager);
+
+    auto && expansions_coefficients{*manager->template get_property<PropExp_t>(
+        rep_expansion.get_name(), true, true, ExcludeGhosts)};
 
     this->initialize_per_center_bispectrum_soap_vectors(
         soap_vectors, expansions_coefficients, manager);
 
-    using complex = std::complex<double>;
+    // buffer for the bispectrum of one species triplet
+    math::Matrix_t bispectrum_by_type(
+        this->bispectrum_couplings.get_n_outputs(),
+        math::pow(this->max_radial, 3_size_t));
 
     // factor that takes into acount the missing equivalent off diagonal
     // element with respect to the key (or species) index
@@ -1090,111 +1580,12 @@ namespace rascal {
 
             if (soap_vector.count(triplet_type) == 1) {
               auto && soap_vector_by_type{soap_vector[triplet_type]};
-
-              size_t nn{0};
-              for (size_t n1{0}; n1 < this->max_radial; n1++) {
-                for (size_t n2{0}; n2 < this->max_radial; n2++) {
-                  for (size_t n3{0}; n3 < this->max_radial; n3++) {
-                    size_t l0{0};
-                    int wigner_count{0};
-                    for (size_t l1{0}; l1 < this->max_angular + 1; l1++) {
-                      for (size_t l2{0}; l2 < this->max_angular + 1; l2++) {
-                        for (size_t l3{0}; l3 < this->max_angular + 1; l3++) {
-                          if (this->inversion_symmetry == true) {
-                            if ((l1 + l2 + l3) % 2 == 1) {
-                              continue;
-                            }
-                          }
-
-                          if ((l1 <
-                               static_cast<size_t>(std::abs<int>(l2 - l3))) ||
-                              (l1 > l2 + l3)) {
-                            continue;
-                          }
-
-                          for (size_t m1{0}; m1 < 2 * l1 + 1; m1++) {
-                            int m1s{static_cast<int>(m1 - l1)};
-                            size_t lm1{math::pow(l1, 2_size_t) + m1};
-                            for (size_t m2{0}; m2 < 2 * l2 + 1; m2++) {
-                              int m2s{static_cast<int>(m2 - l2)};
-                              size_t lm2{math::pow(l2, 2_size_t) + m2};
-                              for (size_t m3{0}; m3 < 2 * l3 + 1; m3++) {
-                                int m3s{static_cast<int>(m3 - l3)};
-                                if (m1s + m2s + m3s != 0) {
-                                  continue;
-                                }
-                                size_t lm3{math::pow(l3, 2_size_t) + m3};
-                                double w3j = this->wigner_w3js[wigner_count];
-                                complex coef1c, coef2c, coef3c;
-                                // usual formulae for converting from real to
-                                // complex
-                                // see src/math/spherical_harmonics.hh for the
-                                // inverse transformation
-                                // TODO(andrea, michael) avoid complex
-                                // arithmetic
-                                if (m1s > 0) {
-                                  coef1c = math::pow(-1, m1s) *
-                                           complex{coef1(n1, lm1),
-                                                   coef1(n1, lm1 - 2 * m1s)};
-                                } else if (m1s == 0) {
-                                  coef1c = complex(coef1(n1, lm1), 0.0) *
-                                           math::SQRT_TWO;
-                                } else if (m1s < 0) {
-                                  coef1c = complex{coef1(n1, lm1 - 2 * m1s),
-                                                   -coef1(n1, lm1)};
-                                }
-                                if (m2s > 0) {
-                                  coef2c = math::pow(-1.0, m2s) *
-                                           complex{coef2(n2, lm2),
-                                                   coef2(n2, lm2 - 2 * m2s)};
-                                } else if (m2s == 0) {
-                                  coef2c = complex(coef2(n2, lm2), 0.0) *
-                                           math::SQRT_TWO;
-                                } else if (m2s < 0) {
-                                  coef2c = complex{coef2(n2, lm2 - 2 * m2s),
-                                                   -coef2(n2, lm2)};
-                                }
-                                if (m3s > 0) {
-                                  coef3c = math::pow(-1.0, m3s) *
-                                           complex{coef3(n3, lm3),
-                                                   coef3(n3, lm3 - 2 * m3s)};
-                                } else if (m3s == 0) {
-                                  coef3c = complex(coef3(n3, lm3), 0.0) *
-                                           math::SQRT_TWO;
-                                } else if (m3s < 0) {
-                                  coef3c = complex{coef3(n3, lm3 - 2 * m3s),
-                                                   -coef3(n3, lm3)};
-                                }
-                                coef1c *= math::INV_SQRT_TWO;
-                                coef2c *= math::INV_SQRT_TWO;
-                                coef3c *= math::INV_SQRT_TWO;
-
-                                // The descriptor components are purely real or
-                                // imaginary
-                                // depending on the divisibility of l1 + l2 +l3
-                                // by 2.
-                                if ((l1 + l2 + l3) % 2 == 0) {
-                                  soap_vector_by_type(nn, l0) +=
-                                      w3j * mult *
-                                      (coef1c * coef2c * coef3c).real();
-                                } else {
-                                  soap_vector_by_type(nn, l0) +=
-                                      w3j * mult *
-                                      (coef1c * coef2c * coef3c).imag();
-                                }
-                                wigner_count++;
-                              }  // m3
-                            }    // m2
-                          }      // m1
-                          l0++;
-                        }  // l3
-                      }    // l2
-                    }      // l1
-                    nn++;
-                  }  // n3
-                }    // n2
-              }      // n1
-            }        // if count triplet
+              // the coupling works on (lm, n) ordered coefficients
+              this->bispectrum_couplings.contract(
+                  coef1.transpose(), coef2.transpose(), coef3.transpose(),
+                  bispectrum_by_type);
+              soap_vector_by_type += mult * bispectrum_by_type.transpose();
+            }  // if count triplet
           }          // coef3
         }            // coef2
       }              // coef1
@@ -1204,6 +1595,8 @@ namespace rascal {
         soap_vector.normalize_and_get_norm();
       }
     }  // center
+    soap_vectors.set_updated_status(true);
+    this->release_expansion(manager);
   }    // end function
 
   template <class StructureManager, class Invariants, class ExpansionCoeff>
@@ -1212,18 +1605,8 @@ namespace rascal {
       Invariants & soap_vectors, ExpansionCoeff & expansions_coefficients,
       std::shared_ptr<StructureManager> manager) {
     size_t n_row{math::pow(this->max_radial, 3_size_t)};
-    size_t n_col{0};
-    double max_ang{static_cast<double>(this->max_angular)};
-    if (this->inversion_symmetry == false) {
-      n_col = static_cast<size_t>(1.0 + 2.0 * max_ang +
-                                  1.5 * math::pow(max_ang, 2_size_t) +
-                                  math::pow(max_ang, 3_size_t) * 0.5);
-    } else {
-      n_col = static_cast<size_t>(
-          std::floor(((math::pow(max_ang + 1.0, 2_size_t) + 1) *
-                      (2 * (max_ang + 1.0) + 3)) /
-                     8.0));
-    }
+    // one column per (l1, l2, l3)
+    size_t n_col{this->bispectrum_couplings.get_n_outputs()};
 
     // clear the data container and resize it
     soap_vectors.clear();
@@ -1259,12 +1642,14 @@ namespace rascal {
   }
 
   template <class StructureManager, class Invariants,
-            class InvariantsDerivative, class ExpansionCoeff>
+            class InvariantsDerivative, class ExpansionCoeff,
+            class ExpansionCoeffDerivative>
   void CalculatorSphericalInvariants::
       initialize_per_center_powerspectrum_soap_vectors(
           Invariants & soap_vectors,
           InvariantsDerivative & soap_vector_gradients,
           ExpansionCoeff & expansions_coefficients,
+          ExpansionCoeffDerivative & expansions_coefficients_gradient,
           std::shared_ptr<StructureManager> manager) {
     if (this->is_sparsified) {
       size_t n_row{this->inner_invariants_shape[0]};
@@ -1294,7 +1679,6 @@ namespace rascal {
     } else {
       size_t n_row{this->inner_invariants_shape[0]};
       size_t n_col{this->inner_invariants_shape[1]};
-      this->coeff_indices_map.clear();
       // clear the data container and resize it
       soap_vectors.clear();
       soap_vectors.set_shape(n_row, n_col);
@@ -1304,40 +1688,16 @@ namespace rascal {
         soap_vector_gradients.set_shape(ThreeD * n_row, n_col);
       }
 
-      std::vector<
-          std::set<internal::SortedKey<Key_t>, internal::CompareSortedKeyLess>>
-          keys_list{};
-      std::vector<
-          std::set<internal::SortedKey<Key_t>, internal::CompareSortedKeyLess>>
-          keys_list_grad{};
-
-      // identify the species in each environment and initialize soap_vectors
-      for (auto center : manager) {
-        auto atom_i_tag = center.get_atom_tag();
-        auto & coefficients{expansions_coefficients[center]};
-        internal::Sorted<true> is_sorted{};
-
-        std::set<internal::SortedKey<Key_t>, internal::CompareSortedKeyLess>
-            pair_list{};
-        int center_type{center.get_atom_type()};
-        Key_t pair_type{center_type, center_type};
-        // avoid checking the order in pair_type by ensuring it has already been
-        // done
-        internal::SortedKey<Key_t> spair_type{is_sorted, pair_type};
-
-        pair_list.insert({is_sorted, pair_type});
+      using PairList_t =
+          std::set<internal::SortedKey<Key_t>, internal::CompareSortedKeyLess>;
+      internal::Sorted<true> is_sorted{};
+      // the keys of the expansion always contain the center type (or its
+      // pseudo species channels for an 'alchemical' expansion)
+      auto get_pair_list = [&is_sorted](const auto & coefficients) {
+        PairList_t pair_list{};
+        Key_t pair_type{0, 0};
         for (const auto & el1 : coefficients) {
           auto && neigh1_type{el1.first[0]};
-          if (center_type <= neigh1_type) {
-            pair_type[0] = center_type;
-            pair_type[1] = neigh1_type;
-          } else {
-            pair_type[1] = center_type;
-            pair_type[0] = neigh1_type;
-          }
-
-          pair_list.insert({is_sorted, pair_type});
-
           for (const auto & el2 : coefficients) {
             auto && neigh2_type{el2.first[0]};
             if (neigh1_type <= neigh2_type) {
@@ -1347,8 +1707,38 @@ namespace rascal {
             }
           }
         }
+        return pair_list;
+      };
+
+      if (expansions_coefficients.are_keys_uniform() and
+          not this->compute_gradients) {
+        // e.g. with global_species: the soap vectors share their keys too and
+        // get a dense storage without building a set of keys per center
+        soap_vectors.resize(get_pair_list(expansions_coefficients[0]));
+        soap_vectors.setZero();
+        soap_vector_gradients.resize();
+        return;
+      }
+
+      std::vector<PairList_t> keys_list{};
+      std::vector<PairList_t> keys_list_grad{};
+
+      // identify the species in each environment and initialize soap_vectors
+      for (auto center : manager) {
+        auto atom_i_tag = center.get_atom_tag();
+        auto & coefficients{expansions_coefficients[center]};
+        Key_t pair_type{0, 0};
+
+        PairList_t pair_list{get_pair_list(coefficients)};
         keys_list.emplace_back(pair_list);
-        if (this->compute_gradients) {
+        if (this->compute_gradients and
+            not this->rep_expansion.is_gradient_atom(atom_i_tag)) {
+          // the positional derivatives wrt this center are not requested
+          for (auto neigh : center.pairs_with_self_pair()) {
+            (void)neigh;  // to avoid compiler warning
+            keys_list_grad.emplace_back();
+          }
+        } else if (this->compute_gradients) {
           keys_list_grad.emplace_back(pair_list);
 
           // Neighbour gradients need a separate pair list because if the
@@ -1359,20 +1749,20 @@ namespace rascal {
             auto atom_j = neigh.get_atom_j();
             auto & coef_j = expansions_coefficients[atom_j];
             auto atom_j_tag = atom_j.get_atom_tag();
-            std::set<internal::SortedKey<Key_t>, internal::CompareSortedKeyLess>
-                grad_pair_list{};
+            PairList_t grad_pair_list{};
             // grad contribution is not zero if the neighbour is _not_ an
             // image of the center
             if (atom_j_tag != atom_i_tag) {
               // list of keys present in the neighbor environment (contains
-              // center_type by definition)
+              // the keys of \grad_i c^{j} by definition)
               std::vector<Key_t> keys_j{coef_j.get_keys()};
+              auto & grad_coef_ij = expansions_coefficients_gradient[neigh];
 
               for (const auto & neigh_1_type : keys_j) {
                 for (const auto & neigh_2_type : keys_j) {
                   if (neigh_1_type[0] <= neigh_2_type[0]) {
-                    if ((center_type == neigh_1_type[0]) or
-                        (center_type == neigh_2_type[0])) {
+                    if (grad_coef_ij.count(neigh_1_type) or
+                        grad_coef_ij.count(neigh_2_type)) {
                       pair_type[0] = neigh_1_type[0];
                       pair_type[1] = neigh_2_type[0];
                       grad_pair_list.insert({is_sorted, pair_type});
@@ -1384,14 +1774,7 @@ namespace rascal {
             keys_list_grad.emplace_back(grad_pair_list);
           }  // auto neigh : center.pairs()
         }    // if compute_gradients
-
-        // initialize coeff_indices_map if the representation is not sparsified
-        for (const auto & key : pair_list) {
-          if (not this->coeff_indices_map.count(key)) {
-            this->coeff_indices_map[key] = coeff_indices;
-          }
-        }
-      }  // for center : manager
+      }      // for center : manager
 
       soap_vectors.resize(keys_list);
       soap_vectors.setZero();
@@ -1433,13 +1816,17 @@ namespace rascal {
       for (const auto & el1 : coefficients) {
         keys.insert({el1.first[0]});
       }
-      keys.insert({center.get_atom_type()});
       // initialize the radial spectrum to 0 and the proper size
       keys_list.emplace_back(keys);
-      keys_list_grad.emplace_back(keys);
-      for (auto neigh : center.pairs()) {
+      const bool is_gradient_center{
+          this->rep_expansion.is_gradient_atom(center.get_atom_tag())};
+      for (auto neigh : center.pairs_with_self_pair()) {
         (void)neigh;  // to avoid compiler warning
-        keys_list_grad.emplace_back(keys);
+        if (is_gradient_center) {
+          keys_list_grad.emplace_back(keys);
+        } else {
+          keys_list_grad.emplace_back();
+        }
       }
     }
 
@@ -37,6 +37,7 @@
 #include "rascal/structure_managers/property.hh"
 #include "rascal/structure_managers/structure_manager.hh"
 #include "rascal/utils/basic_types.hh"
+#include "rascal/utils/instrumentation.hh"
 #include "rascal/utils/utils.hh"
 
 #include <set>
@@ -841,6 +842,8 @@ namespace rascal {
   template <class ManagerImplementation>
   void AdaptorNeighbourList<ManagerImplementation>::update_self() {
     if (this->need_update) {
+      instrumentation::ScopedTimer timer{"neighbour list"};
+      instrumentation::add_count("neighbour list rebuilds");
       // set the number of centers
       this->n_centers = this->manager->get_size();
       // this->n_atoms = this->manager->get_n_atoms();
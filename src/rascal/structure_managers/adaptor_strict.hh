@@ -34,8 +34,12 @@
 #include "rascal/structure_managers/property.hh"
 #include "rascal/structure_managers/structure_manager.hh"
 #include "rascal/structure_managers/updateable_base.hh"
+#include "rascal/utils/instrumentation.hh"
 #include "rascal/utils/utils.hh"
 
+#include <algorithm>
+#include <vector>
+
 namespace rascal {
   /*
    * forward declaration for traits
@@ -71,6 +75,11 @@ namespace rascal {
    * below the cutoff. This is also useful to extract managers with different
    * levels of truncation from a single, loose manager.
    *
+   * If `sort_by_distance` is set, the neighbours of each center are listed
+   * by increasing distance (the center itself first when the self pair is
+   * present) so that consumers using a smaller cutoff can stop iterating at
+   * the first neighbour beyond it.
+   *
    * This interface should be implemented by all managers with the trait
    * AdaptorTraits::Strict::yes
    */
@@ -108,13 +117,19 @@ namespace rascal {
     /**
      * construct a strict neighbourhood list from a given manager. `cut-off`
      * specifies the strict cutoff radius. all clusters with distances above
-     * this parameter will be skipped
+     * this parameter will be skipped. `sort_by_distance` orders the
+     * neighbours of every center by increasing distance.
      */
-    AdaptorStrict(ImplementationPtr_t manager, double cutoff);
+    AdaptorStrict(ImplementationPtr_t manager, double cutoff,
+                  bool sort_by_distance = false);
 
     AdaptorStrict(ImplementationPtr_t manager, const Hypers_t & adaptor_hypers)
         : AdaptorStrict(manager,
-                        adaptor_hypers.at("cutoff").template get<double>()) {}
+                        adaptor_hypers.at("cutoff").template get<double>(),
+                        adaptor_hypers.count("sort_by_distance")
+                            ? adaptor_hypers.at("sort_by_distance")
+                                  .template get<bool>()
+                            : false) {}
 
     //! Copy constructor
     AdaptorStrict(const AdaptorStrict & other) = delete;
@@ -141,6 +156,11 @@ namespace rascal {
     //! returns the (strict) cutoff for the adaptor
     double get_cutoff() const { return this->cutoff; }
 
+    //! tells if the neighbours of each center are sorted by distance
+    AdaptorTraits::SortedByDistance get_sorted_by_distance() const {
+      return this->sorted_by_distance;
+    }
+
     size_t get_nb_clusters(int order) const {
       assert(order == 2);
       return this->atom_tag_list[order - 1].size();
@@ -287,10 +307,29 @@ namespace rascal {
       this->template add_atom<Order - 1>(cluster.back());
     }
 
+    //! add the neighbour atom_tag of the current center with its geometry
+    template <class ClusterIndices>
+    void add_pair(int atom_tag, const Eigen::Vector3d & vec_ij,
+                  double distance2, const ClusterIndices & cluster_indices,
+                  size_t & pair_counter);
+
+    /**
+     * Neighbour of the current center waiting to be added once all the
+     * neighbours have been sorted by distance
+     */
+    struct PairCandidate {
+      double distance2;
+      int atom_tag;
+      Eigen::Vector3d vec_ij;
+      Eigen::Matrix<size_t, PairLayer, 1> cluster_indices;
+      EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+    };
+
     ImplementationPtr_t manager;
     std::shared_ptr<Distance_t> distance;
     std::shared_ptr<DirectionVector_t> dir_vec;
     const double cutoff;
+    AdaptorTraits::SortedByDistance sorted_by_distance;
 
     /**
      * store atom tags per order,i.e.
@@ -348,10 +387,14 @@ namespace rascal {
   /*--------------------------------------------------------------------------*/
   template <class ManagerImplementation>
   AdaptorStrict<ManagerImplementation>::AdaptorStrict(
-      std::shared_ptr<ManagerImplementation> manager, double cutoff)
+      std::shared_ptr<ManagerImplementation> manager, double cutoff,
+      bool sort_by_distance)
       : manager{std::move(manager)}, distance{std::make_shared<Distance_t>(
                                          *this)},
         dir_vec{std::make_shared<DirectionVector_t>(*this)}, cutoff{cutoff},
+        sorted_by_distance{sort_by_distance
+                               ? AdaptorTraits::SortedByDistance::yes
+                               : AdaptorTraits::SortedByDistance::no},
         atom_tag_list{}, neighbours_cluster_index{}, nb_neigh{}, offsets{}
 
   {
@@ -368,9 +411,35 @@ namespace rascal {
     this->manager->update(std::forward<Args>(arguments)...);
   }
 
+  /* ---------------------------------------------------------------------- */
+  template <class ManagerImplementation>
+  template <class ClusterIndices>
+  void AdaptorStrict<ManagerImplementation>::add_pair(
+      int atom_tag, const Eigen::Vector3d & vec_ij, double distance2,
+      const ClusterIndices & cluster_indices, size_t & pair_counter) {
+    auto & pair_cluster_indices{std::get<1>(this->cluster_indices_container)};
+    this->template add_atom<1>(atom_tag);
+    double distance{std::sqrt(distance2)};
+    if (distance2 > 0.) {
+      this->dir_vec->push_back((vec_ij.array() / distance).matrix());
+    } else {
+      this->dir_vec->push_back((vec_ij.array()).matrix());
+    }
+
+    this->distance->push_back(distance);
+
+    Eigen::Matrix<size_t, PairLayer + 1, 1> indices_pair;
+    indices_pair.template head<PairLayer>() = cluster_indices;
+    indices_pair(PairLayer) = pair_counter;
+    pair_cluster_indices.push_back(indices_pair);
+    pair_counter++;
+  }
+
   /* ---------------------------------------------------------------------- */
   template <class ManagerImplementation>
   void AdaptorStrict<ManagerImplementation>::update_self() {
+    instrumentation::ScopedTimer timer{"strict cutoff"};
+    instrumentation::add_count("strict cutoff rebuilds");
     //! Reset cluster_indices for adaptor to fill with push back.
     internal::for_each(this->cluster_indices_container,
                        internal::ResizePropertyToZero());
@@ -397,11 +466,15 @@ namespace rascal {
 
     // fill the list, at least pairs are mandatory for this to work
     auto & atom_cluster_indices{std::get<0>(this->cluster_indices_container)};
-    auto & pair_cluster_indices{std::get<1>(this->cluster_indices_container)};
 
     size_t pair_counter{0};
+    size_t n_pairs_visited{0};
 
     double rc2{this->cutoff * this->cutoff};
+    const bool sort_pairs{this->sorted_by_distance ==
+                          AdaptorTraits::SortedByDistance::yes};
+    std::vector<PairCandidate, Eigen::aligned_allocator<PairCandidate>>
+        candidates{};
 
     for (auto && atom : this->manager) {
       this->add_atom(atom);
@@ -413,27 +486,31 @@ namespace rascal {
       indices.template head<AtomLayer>() = atom.get_cluster_indices();
       indices(AtomLayer) = indices(AtomLayer - 1);
       atom_cluster_indices.push_back(indices);
+      candidates.clear();
       for (auto pair : atom.pairs_with_self_pair()) {
-        auto vec_ij{pair.get_position() - atom.get_position()};
+        ++n_pairs_visited;
+        Eigen::Vector3d vec_ij{pair.get_position() - atom.get_position()};
         double distance2{(vec_ij).squaredNorm()};
         if (distance2 <= rc2) {
-          this->add_atom(pair);
-          double distance{std::sqrt(distance2)};
-          if (distance2 > 0.) {
-            this->dir_vec->push_back((vec_ij.array() / distance).matrix());
+          if (sort_pairs) {
+            candidates.push_back(PairCandidate{distance2, pair.back(), vec_ij,
+                                               pair.get_cluster_indices()});
           } else {
-            this->dir_vec->push_back((vec_ij.array()).matrix());
+            this->add_pair(pair.back(), vec_ij, distance2,
+                           pair.get_cluster_indices(), pair_counter);
           }
-
-          this->distance->push_back(distance);
-
-          Eigen::Matrix<size_t, PairLayer + 1, 1> indices_pair;
-          indices_pair.template head<PairLayer>() = pair.get_cluster_indices();
-          indices_pair(PairLayer) = pair_counter;
-          pair_cluster_indices.push_back(indices_pair);
-          pair_counter++;
         }
       }
+      // stable so that the self pair (and exact ties) keep their order
+      std::stable_sort(candidates.begin(), candidates.end(),
+                       [](const PairCandidate & a, const PairCandidate & b) {
+                         return a.distance2 < b.distance2;
+                       });
+      for (auto && candidate : candidates) {
+        this->add_pair(candidate.atom_tag, candidate.vec_ij,
+                       candidate.distance2, candidate.cluster_indices,
+                       pair_counter);
+      }
     }
 
     for (auto && atom : this->manager->only_ghosts()) {
@@ -451,6 +528,8 @@ namespace rascal {
 
     this->distance->set_updated_status(true);
     this->dir_vec->set_updated_status(true);
+    instrumentation::add_count("strict cutoff pairs visited", n_pairs_visited);
+    instrumentation::add_count("strict cutoff pairs", pair_counter);
   }
 }  // namespace rascal
 
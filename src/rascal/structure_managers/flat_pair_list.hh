@@ -0,0 +1,120 @@
+/**
+ * @file   rascal/structure_managers/flat_pair_list.hh
+ *
+ * @author  Felix Musil <felix.musil@epfl.ch>
+ *
+ * @date   18 October 2026
+ *
+ * @brief Compressed sparse row copy of the pairs of a structure manager
+ *
+ * Copyright  2026  Felix Musil, COSMO (EPFL), LAMMM (EPFL)
+ *
+ * Rascal is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3, or (at
+ * your option) any later version.
+ *
+ * Rascal is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file LICENSE. If not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef SRC_RASCAL_STRUCTURE_MANAGERS_FLAT_PAIR_LIST_HH_
+#define SRC_RASCAL_STRUCTURE_MANAGERS_FLAT_PAIR_LIST_HH_
+
+#include "rascal/utils/utils.hh"
+
+#include <Eigen/Dense>
+
+#include <memory>
+#include <vector>
+
+namespace rascal {
+
+  /**
+   * The centers and pairs of a structure manager copied in flat arrays, in
+   * the order of `for (auto center : manager)` and
+   * `for (auto neigh : center.pairs())`. The pairs of center i_center are
+   * [center_offsets[i_center], center_offsets[i_center + 1]), so that the
+   * loops over the pairs can be written as plain indexed loops:
+   *
+   *     for (size_t i_pair{0}; i_pair < pairs.size(); ++i_pair) {
+   *       values[pairs.pair_indices[i_pair]] = f(pairs.distances[i_pair]);
+   *     }
+   *
+   * The center_indices and pair_indices are the indices of the clusters in
+   * the order 1 and order 2 properties of the manager given to update and
+   * the neighbour_atom_indices the ones of the neighbours in the order 1
+   * properties (e.g. the gradients with respect to the neighbour).
+   *
+   * The arrays are copies, they are not updated with the manager. The
+   * capacity is kept between calls to update so the same object can be
+   * reused for all the structures of a collection.
+   */
+  struct FlatPairList {
+    //! first pair of each center, followed by the number of pairs
+    std::vector<size_t> center_offsets{0};
+    std::vector<size_t> center_indices{};
+    std::vector<int> center_species{};
+    std::vector<size_t> pair_indices{};
+    std::vector<size_t> neighbour_atom_indices{};
+    std::vector<int> neighbour_species{};
+    std::vector<double> distances{};
+    //! unit vector from the center to the neighbour, ThreeD values per pair
+    std::vector<double> directions{};
+
+    //! number of pairs
+    size_t size() const { return this->pair_indices.size(); }
+
+    //! the directions as a ThreeD x size() matrix
+    Eigen::Map<const Eigen::Matrix<double, ThreeD, Eigen::Dynamic>>
+    get_directions() const {
+      return Eigen::Map<const Eigen::Matrix<double, ThreeD, Eigen::Dynamic>>(
+          this->directions.data(), ThreeD, this->size());
+    }
+
+    size_t get_nb_centers() const { return this->center_indices.size(); }
+
+    //! fill the arrays with the centers and pairs of manager
+    template <class StructureManager>
+    void update(const std::shared_ptr<StructureManager> & manager) {
+      static_assert(StructureManager::traits::HasDistances and
+                        StructureManager::traits::HasDirectionVectors,
+                    "The pairs need distances and direction vectors, e.g. "
+                    "from AdaptorStrict.");
+      this->center_offsets.resize(1);
+      this->center_indices.clear();
+      this->center_species.clear();
+      this->pair_indices.clear();
+      this->neighbour_atom_indices.clear();
+      this->neighbour_species.clear();
+      this->distances.clear();
+      this->directions.clear();
+
+      for (auto center : manager) {
+        this->center_indices.push_back(manager->get_offset(center));
+        this->center_species.push_back(center.get_atom_type());
+        for (auto neigh : center.pairs()) {
+          this->pair_indices.push_back(manager->get_offset(neigh));
+          this->neighbour_atom_indices.push_back(manager->get_atom_index(
+              neigh.get_internal_neighbour_atom_tag()));
+          this->neighbour_species.push_back(neigh.get_atom_type());
+          this->distances.push_back(manager->get_distance(neigh));
+          auto && direction{manager->get_direction_vector(neigh)};
+          this->directions.insert(this->directions.end(), direction.data(),
+                                  direction.data() + ThreeD);
+        }
+        this->center_offsets.push_back(this->pair_indices.size());
+      }
+    }
+  };
+
+}  // namespace rascal
+
+#endif  // SRC_RASCAL_STRUCTURE_MANAGERS_FLAT_PAIR_LIST_HH_
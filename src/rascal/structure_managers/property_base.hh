@@ -39,6 +39,15 @@
 
 namespace rascal {
 
+  /**
+   * Lifetime of a property attached to a structure manager. Persistent
+   * properties live as long as the manager. Transient properties hold
+   * intermediate results, e.g. the spherical expansion used to build the
+   * spherical invariants, and are released by the manager as soon as the
+   * calculator that needs them is done.
+   */
+  enum class PropertyLifetime { Persistent, Transient };
+
   /**
    * Base class defintion of a ``property``, defining an interface.
    */
@@ -65,6 +74,9 @@ namespace rascal {
     //! return compile time type information
     virtual const std::string & get_type_info() const = 0;
 
+    //! number of bytes held by the property, its storage included
+    virtual size_t get_memory_usage() const = 0;
+
     //! returns the number of degrees of freedom stored per cluster
     Dim_t get_nb_comp() const { return this->nb_comp; }
 
@@ -111,6 +123,14 @@ namespace rascal {
 
     void set_updated_status(bool is_updated) { this->updated = is_updated; }
 
+    PropertyLifetime get_lifetime() const { return this->lifetime; }
+
+    void set_lifetime(PropertyLifetime lifetime) { this->lifetime = lifetime; }
+
+    bool is_transient() const {
+      return this->lifetime == PropertyLifetime::Transient;
+    }
+
    protected:
     //!< base-class reference to StructureManager
     StructureManagerBase & base_manager;
@@ -125,6 +145,8 @@ namespace rascal {
     //! tells if the property is in synch with the underlying structure of
     //! the structure manager
     bool updated{false};
+    //! tells the manager when the property can be released
+    PropertyLifetime lifetime{PropertyLifetime::Persistent};
     //! constructor
     PropertyBase(StructureManagerBase & manager, Dim_t nb_row, Dim_t nb_col,
                  size_t order, size_t layer,
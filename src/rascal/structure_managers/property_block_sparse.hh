@@ -33,15 +33,21 @@
 #include "rascal/math/utils.hh"
 #include "rascal/structure_managers/cluster_ref_key.hh"
 #include "rascal/structure_managers/property_base.hh"
+#include "rascal/utils/mapped_file.hh"
 #include "rascal/utils/utils.hh"
 
 #include <algorithm>
 #include <iterator>
 #include <list>
 #include <map>
+#include <memory>
+#include <new>
 #include <set>
+#include <stdexcept>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace rascal {
   namespace internal {
@@ -133,11 +139,126 @@ namespace rascal {
       }
     };
 
+    /**
+     * Associative container with the subset of the std::map interface used
+     * by the layouts of BlockSparseProperty. The entries are kept sorted by
+     * key in a single contiguous vector: a layout typically holds one key
+     * (e.g. the gradient of a neighbour) or a handful of keys, so this avoids
+     * one tree node allocation per key and the pointer chasing of the lookups.
+     */
+    template <class K, class V>
+    class SortedVectorMap {
+     public:
+      using key_type = K;
+      using mapped_type = V;
+      using value_type = std::pair<K, V>;
+      using Container_t = std::vector<value_type>;
+      using size_type = typename Container_t::size_type;
+      using iterator = typename Container_t::iterator;
+      using const_iterator = typename Container_t::const_iterator;
+
+      iterator begin() noexcept { return this->entries.begin(); }
+      iterator end() noexcept { return this->entries.end(); }
+      const_iterator begin() const noexcept { return this->entries.begin(); }
+      const_iterator end() const noexcept { return this->entries.end(); }
+
+      size_type size() const noexcept { return this->entries.size(); }
+      bool empty() const noexcept { return this->entries.empty(); }
+      void clear() noexcept { this->entries.clear(); }
+      void reserve(size_type n) { this->entries.reserve(n); }
+      size_type capacity() const noexcept { return this->entries.capacity(); }
+
+      iterator find(const key_type & key) {
+        auto it{this->lower_bound(key)};
+        return (it != this->end() and it->first == key) ? it : this->end();
+      }
+
+      const_iterator find(const key_type & key) const {
+        auto it{this->lower_bound(key)};
+        return (it != this->end() and it->first == key) ? it : this->end();
+      }
+
+      size_type count(const key_type & key) const {
+        return this->find(key) == this->end() ? 0 : 1;
+      }
+
+      mapped_type & at(const key_type & key) {
+        auto it{this->find(key)};
+        if (it == this->end()) {
+          throw std::out_of_range("SortedVectorMap::at: key not found");
+        }
+        return it->second;
+      }
+
+      const mapped_type & at(const key_type & key) const {
+        auto it{this->find(key)};
+        if (it == this->end()) {
+          throw std::out_of_range("SortedVectorMap::at: key not found");
+        }
+        return it->second;
+      }
+
+      //! access or insert specified element, appending is the cheap case
+      mapped_type & operator[](const key_type & key) {
+        auto it{this->lower_bound(key)};
+        if (it == this->end() or not(it->first == key)) {
+          it = this->entries.emplace(it, key, mapped_type{});
+        }
+        return it->second;
+      }
+
+     protected:
+      iterator lower_bound(const key_type & key) {
+        if (this->entries.empty() or this->entries.back().first < key) {
+          return this->end();
+        }
+        return std::lower_bound(
+            this->begin(), this->end(), key,
+            [](const value_type & el, const key_type & k) {
+              return el.first < k;
+            });
+      }
+
+      const_iterator lower_bound(const key_type & key) const {
+        if (this->entries.empty() or this->entries.back().first < key) {
+          return this->end();
+        }
+        return std::lower_bound(
+            this->begin(), this->end(), key,
+            [](const value_type & el, const key_type & k) {
+              return el.first < k;
+            });
+      }
+
+      Container_t entries{};
+    };
+
+    /**
+     * Keys of a block sparse entry and the position of their blocks relative
+     * to the start of the entry. The distinct sets of keys of a property are
+     * stored once in a table and shared by all the entries with the same keys
+     * (e.g. all the centers of a given species), so that an entry only holds
+     * the id of its layout and the offset of its data.
+     */
+    template <class K>
+    struct BlockSparseLayout {
+      //! relative position of the block of each key, sorted by key
+      SortedVectorMap<K, size_t> offsets{};
+      //! shape of the blocks
+      int n_row{0};
+      int n_col{0};
+      //! size of an entry with this layout
+      size_t total_length{0};
+      //! hash of the combined keys
+      size_t key_hash{0};
+    };
+
     template <class K, class V>
     class InternallySortedKeyMap {
      public:
-      using MyMap_t = std::map<K, V>;
-      using Map_t = std::map<K, std::tuple<int, int, int>>;
+      using Layout_t = BlockSparseLayout<K>;
+      using Layouts_t = std::vector<Layout_t>;
+      using Map_t = SortedVectorMap<K, size_t>;
       using Precision_t = typename V::value_type;
       using Array_t = Eigen::Array<Precision_t, Eigen::Dynamic, 1>;
       using Vector_t = Eigen::Matrix<Precision_t, Eigen::Dynamic, 1>;
@@ -145,25 +266,23 @@ namespace rascal {
       using VectorMapConst_Ref_t = typename Eigen::Map<const Vector_t>;
       using ArrayMap_Ref_t = typename Eigen::Map<Array_t>;
       using Array_Ref_t = typename Eigen::Ref<Array_t>;
+      //! view of the storage of the property, rebound when it moves
+      using Storage_t = Eigen::Map<Array_t>;
       using Self_t = InternallySortedKeyMap<K, V>;
       //! ref to the main data.
-      Array_t & data;
-      //! map the keys to positions in data
-      Map_t map{};
+      Storage_t & data;
+      //! ref to the table of layouts of the property
+      const Layouts_t & layouts;
+      //! position of the keys of the object in layouts
+      size_t layout_id{0};
       //! start of the chunck in data relevant to the object
       size_t global_offset;
-      //! size of the chunck in data relevant to the object
-      size_t total_length{0};
-      //! keep track if the block of data has been normalized
-      bool normalized{false};
-      //! store the hash of the combined key
-      size_t key_hash{0};
 
       // some member types
-      using key_type = typename MyMap_t::key_type;
+      using key_type = K;
       using mapped_type = V;
       using value_type = std::pair<const K, mapped_type>;
-      using size_type = typename MyMap_t::size_type;
+      using size_type = size_t;
       using reference = typename Eigen::Map<V>;
       using const_reference = typename Eigen::Map<const V>;
 
@@ -178,24 +297,22 @@ namespace rascal {
        public:
         using Self_t = Iterator<Value>;
 
-        // to handle properly const and normal cases
-        using It_t = typename std::conditional<std::is_const<Value>::value,
-                                               typename Map_t::const_iterator,
-                                               typename Map_t::iterator>::type;
+        using It_t = typename Map_t::const_iterator;
 
         using MyData_t =
             typename std::conditional<std::is_const<Value>::value,
-                                      const Array_t, Array_t>::type;
+                                      const Storage_t, Storage_t>::type;
         // Map<const Matrix> is already write-only so remove the const
         // which is used to determine the cv of the iterator
         using Value_t = typename std::remove_const<Value>::type;
 
-        Iterator(MyData_t & data, It_t map_iterator)
-            : data{data}, map_iterator{map_iterator} {}
+        Iterator(MyData_t & data, const Layout_t & layout,
+                 size_t global_offset, It_t map_iterator)
+            : data{data}, layout{layout}, global_offset{global_offset},
+              map_iterator{map_iterator} {}
 
         Self_t & operator++() {
           map_iterator++;
-          // this->update_current_data();
           return *this;
         }
         Self_t operator++(int) {
@@ -205,11 +322,9 @@ namespace rascal {
         }
         std::pair<K, Value_t> operator*() const {
           auto && el{*this->map_iterator};
-          auto && key{el.first};
-          auto && pos{el.second};
-          return std::make_pair(key,
-                                Value_t(&data[std::get<0>(pos)],
-                                        std::get<1>(pos), std::get<2>(pos)));
+          return std::make_pair(
+              el.first, Value_t(&data[this->global_offset + el.second],
+                                this->layout.n_row, this->layout.n_col));
         }
         Self_t & operator--() {
           map_iterator--;
@@ -229,26 +344,41 @@ namespace rascal {
 
        protected:
         MyData_t & data;
+        const Layout_t & layout;
+        size_t global_offset;
         It_t map_iterator;
       };
 
       using iterator = Iterator<reference>;
       using const_iterator = Iterator<const const_reference>;
 
-      iterator begin() noexcept { return iterator(data, map.begin()); }
-      iterator end() noexcept { return iterator(data, map.end()); }
+      iterator begin() noexcept {
+        return iterator(data, this->get_layout(), this->global_offset,
+                        this->get_layout().offsets.begin());
+      }
+      iterator end() noexcept {
+        return iterator(data, this->get_layout(), this->global_offset,
+                        this->get_layout().offsets.end());
+      }
 
       const_iterator begin() const noexcept {
-        return const_iterator(data, map.begin());
+        return const_iterator(data, this->get_layout(), this->global_offset,
+                              this->get_layout().offsets.begin());
       }
       const_iterator end() const noexcept {
-        return const_iterator(data, map.end());
+        return const_iterator(data, this->get_layout(), this->global_offset,
+                              this->get_layout().offsets.end());
       }
 
-      //! Default constructor
-      explicit InternallySortedKeyMap(Array_t & data,
-                                      const size_t & global_offset = 0)
-          : data{data}, global_offset{global_offset} {};
+      /**
+       * Default constructor, the object has the layout layout_id (the first
+       * layout of a property has no keys)
+       */
+      InternallySortedKeyMap(Storage_t & data, const Layouts_t & layouts,
+                             size_t layout_id = 0,
+                             const size_t & global_offset = 0)
+          : data{data}, layouts{layouts}, layout_id{layout_id},
+            global_offset{global_offset} {};
 
       //! Copy constructor
       InternallySortedKeyMap(const InternallySortedKeyMap & other) = default;
@@ -259,26 +389,31 @@ namespace rascal {
       //! Destructor
       ~InternallySortedKeyMap() = default;
 
-      //! Copy assignment operator
+      //! Copy assignment operator, the object keeps viewing its own property
       Self_t & operator=(const Self_t & other) {
-        this->data = other.data;
-        this->map = other.map;
+        this->layout_id = other.layout_id;
         this->global_offset = other.global_offset;
-        this->total_length = other.total_length;
-        this->normalized = other.normalized;
         return *this;
       }
 
       //! Move assignment operator
       Self_t & operator=(Self_t && other) {
-        this->data = std::move(other.data);
-        this->map = std::move(other.map);
-        this->global_offset = std::move(other.global_offset);
-        this->total_length = std::move(other.total_length);
-        this->normalized = std::move(other.normalized);
+        this->layout_id = other.layout_id;
+        this->global_offset = other.global_offset;
         return *this;
       }
 
+      //! keys and block positions of the object
+      const Layout_t & get_layout() const {
+        return this->layouts[this->layout_id];
+      }
+
+      //! id of the layout in the table of the property
+      size_t get_layout_id() const { return this->layout_id; }
+
+      //! position of the entry in the storage of the property
+      size_t get_global_offset() const { return this->global_offset; }
+
       /**
        * Returns a reference to the mapped value of the element with key
        * equivalent to key. If no such element exists, an exception of type
@@ -294,7 +429,10 @@ namespace rascal {
         SortedKey_t skey{key};
         return this->at(skey);
       }
-      //! access or insert specified element
+      /**
+       * access specified element, the keys are fixed by the layout so that
+       * a missing key throws std::out_of_range like at()
+       */
       reference operator[](const key_type & key) {
         SortedKey_t skey{key};
         return this->operator[](skey);
@@ -308,28 +446,22 @@ namespace rascal {
        * Same as above but does not try to sort since we know it already is.
        */
       reference at(const SortedKey_t & skey) {
-        auto & pos{this->map.at(skey.get_key())};
-        return reference(&this->data[std::get<0>(pos)], std::get<1>(pos),
-                         std::get<2>(pos));
+        const auto & layout{this->get_layout()};
+        return reference(&this->data[this->get_position(skey)], layout.n_row,
+                         layout.n_col);
       }
 
       const_reference at(const SortedKey_t & skey) const {
-        auto & pos{this->map.at(skey.get_key())};
-        return const_reference(&this->data[std::get<0>(pos)], std::get<1>(pos),
-                               std::get<2>(pos));
+        const auto & layout{this->get_layout()};
+        return const_reference(&this->data[this->get_position(skey)],
+                               layout.n_row, layout.n_col);
       }
-      //! access or insert specified element
+      //! access specified element
       reference operator[](const SortedKey_t & skey) {
-        auto & pos{this->map[skey.get_key()]};
-        assert(std::get<1>(pos) * std::get<2>(pos) > 0);
-        return reference(&this->data[std::get<0>(pos)], std::get<1>(pos),
-                         std::get<2>(pos));
+        return this->at(skey);
       }
       const_reference operator[](const SortedKey_t & skey) const {
-        auto & pos{this->map.at(skey.get_key())};
-        assert(std::get<1>(pos) * std::get<2>(pos) > 0);
-        return const_reference(&this->data[std::get<0>(pos)], std::get<1>(pos),
-                               std::get<2>(pos));
+        return this->at(skey);
       }
 
       Eigen::Map<const math::Vector_t> flat(const key_type & key) {
@@ -338,10 +470,9 @@ namespace rascal {
       }
 
       Eigen::Map<const math::Vector_t> flat(const SortedKey_t & skey) {
-        auto & pos{this->map[skey.get_key()]};
-        assert(std::get<1>(pos) * std::get<2>(pos) > 0);
+        const auto & layout{this->get_layout()};
         return Eigen::Map<const math::Vector_t>(
-            &this->data[std::get<0>(pos)], std::get<1>(pos) * std::get<2>(pos));
+            &this->data[this->get_position(skey)], layout.n_row * layout.n_col);
       }
 
       int get_location_by_key(const key_type & key) const {
@@ -350,60 +481,19 @@ namespace rascal {
       }
 
       int get_location_by_key(const SortedKey_t & skey) const {
-        const auto & pos{this->map.at(skey.get_key())};
-        return std::get<0>(pos);
+        return static_cast<int>(this->get_position(skey));
       }
+
       /**
-       * Resize the view of the data to the proper size using the keys, and
-       * internal array size n_row and n_col to set up this->map.
-       * The view looks at one entry of the property/structure so global_offset
-       * tells where this entry starts in the structure wise array of the
-       * property.
-       *
-       * Keys_List is a stl container and it is expected that Keys_List is
-       * iterable.
-       *
-       * The use of std::set is to garrantee the order of the keys.
-       *
-       * Args template parameters is there to accomodate with the
-       * fact that most stl container have several optional template parameters
-       * that need to be deduced.
+       * Point the view to the entry starting at global_offset in the
+       * structure wise array of the property, with the keys of layout_id.
        */
-      template <template <typename...> class Key_List, typename... Args>
-      void resize_view(const Key_List<key_type, Args...> & keys, int n_row,
-                       int n_col, const size_t & global_offset) {
-        std::set<SortedKey_t, CompareSortedKeyLess> skeys{};
-        for (auto && key : keys) {
-          SortedKey_t skey{key};
-          skeys.insert(skey);
-        }
-        this->resize_view(skeys, n_row, n_col, global_offset);
-      }
-
-      template <typename... Args>
-      void resize_view(const std::set<SortedKey_t, Args...> & skeys, int n_row,
-                       int n_col, const size_t & global_offset) {
+      void set_layout(size_t layout_id, const size_t & global_offset) {
+        this->layout_id = layout_id;
         this->global_offset = global_offset;
-        size_t current_position{global_offset};
-        size_t block_size{static_cast<size_t>(n_row * n_col)};
-        for (auto && skey : skeys) {
-          auto && key{skey.get_key()};
-          this->map[key] = std::make_tuple(current_position, n_row, n_col);
-          current_position += block_size;
-        }
-        this->total_length = current_position - global_offset;
-        // compute a hash of the keys
-        Hash<key_type> hasher{};
-        key_type flat_keys{};
-        for (const auto & key : this->get_keys()) {
-          for (const auto & el : key) {
-            flat_keys.emplace_back(el);
-          }
-        }
-        this->key_hash = hasher(flat_keys);
       }
 
-      size_t size() const { return this->total_length; }
+      size_t size() const { return this->get_layout().total_length; }
 
       //! Returns the number of elements with key that compares equivalent to
       //! the specified argument, which is either 1 or 0 since this container
@@ -414,31 +504,33 @@ namespace rascal {
       }
 
       size_t count(const SortedKey_t & skey) const {
-        return this->map.count(skey.get_key());
+        return this->get_layout().offsets.count(skey.get_key());
       }
 
-      //! clear the map but does not change the underlying data
-      void clear() noexcept { this->map.clear(); }
+      //! clear the keys but does not change the underlying data
+      void clear() noexcept { this->layout_id = 0; }
 
       VectorMap_Ref_t get_full_vector() {
         return VectorMap_Ref_t(&this->data[this->global_offset],
-                               this->total_length);
+                               this->size());
       }
 
       VectorMapConst_Ref_t get_full_vector() const {
         return VectorMapConst_Ref_t(&this->data[this->global_offset],
-                                    this->total_length);
+                                    this->size());
       }
 
-      //! key_hash member getter
-      size_t get_key_hash() const { return this->key_hash; }
+      //! hash of the keys of the layout
+      size_t get_key_hash() const { return this->get_layout().key_hash; }
 
       /**
        * returns a vector of the valid keys of the map
        */
       std::vector<key_type> get_keys() const {
         std::vector<key_type> keys{};
-        std::transform(this->map.begin(), this->map.end(),
+        const auto & offsets{this->get_layout().offsets};
+        keys.reserve(offsets.size());
+        std::transform(offsets.begin(), offsets.end(),
                        std::back_inserter(keys), RetrieveKey());
         return keys;
       }
@@ -480,13 +572,10 @@ namespace rascal {
        * relevant only when the keys have 2 indices
        */
       void multiply_off_diagonal_elements_by(double fac) {
-        for (const auto & el : this->map) {
+        for (auto el : *this) {
           auto && pair_type{el.first};
-          auto && pos{el.second};
           if (pair_type[0] != pair_type[1]) {
-            auto block{reference(&this->data[std::get<0>(pos)],
-                                 std::get<1>(pos), std::get<2>(pos))};
-            block *= fac;
+            el.second *= fac;
           }
         }
       }
@@ -497,7 +586,11 @@ namespace rascal {
       Precision_t dot(Self_t & B) {
         Precision_t val{0.};
         // avoid breaking down product if this and B have the same layout
-        if (this->get_key_hash() == B.get_key_hash()) {
+        const bool same_layout{
+            (&this->layouts == &B.layouts and
+             this->layout_id == B.layout_id) or
+            this->get_key_hash() == B.get_key_hash()};
+        if (same_layout) {
           const auto vecA = this->get_full_vector();
           const auto vecB = B.get_full_vector();
           val = vecA.dot(vecB);
@@ -506,13 +599,8 @@ namespace rascal {
           auto unique_keys{this->intersection(keys_b)};
 
           for (auto & key : unique_keys) {
-            auto && posA{this->map[key]};
-            auto vecA{VectorMap_Ref_t(&this->data[std::get<0>(posA)],
-                                      std::get<1>(posA) * std::get<2>(posA))};
-            auto && posB{B.map[key]};
-            auto vecB{VectorMap_Ref_t(&B.data[std::get<0>(posB)],
-                                      std::get<1>(posB) * std::get<2>(posB))};
-            val += vecA.dot(vecB);
+            SortedKey_t skey{Sorted<true>{}, key};
+            val += this->flat(skey).dot(B.flat(skey));
           }
         }
         return val;
@@ -524,22 +612,18 @@ namespace rascal {
        */
       template <typename Derived>
       void lhs_dot(const Eigen::EigenBase<Derived> & left_side_mat) {
-        for (const auto & el : this->map) {
-          auto && pos{el.second};
-          auto block{reference(&this->data[std::get<0>(pos)], std::get<1>(pos),
-                               std::get<2>(pos))};
-          block.transpose() *= left_side_mat;
+        for (auto el : *this) {
+          el.second.transpose() *= left_side_mat;
         }
       }
 
       template <int Dim, typename Derived>
       void lhs_dot_der(const Eigen::EigenBase<Derived> & left_side_mat) {
-        for (const auto & el : this->map) {
-          auto && pos{el.second};
-          auto blocks{reference(&this->data[std::get<0>(pos)], std::get<1>(pos),
-                                std::get<2>(pos))};
-          int n_rows{static_cast<int>(std::get<1>(pos) / Dim)};
-          int n_cols{std::get<2>(pos)};
+        const auto & layout{this->get_layout()};
+        int n_rows{layout.n_row / Dim};
+        int n_cols{layout.n_col};
+        for (auto el : *this) {
+          auto && blocks{el.second};
           for (int ii{0}; ii < Dim; ++ii) {
             blocks.block(ii * n_rows, 0, n_rows, n_cols).transpose() *=
                 left_side_mat;
@@ -554,7 +638,7 @@ namespace rascal {
         }
         std::set<key_type> set{keys.cbegin(), keys.cend()};
         std::vector<key_type> intersections;
-        for (const auto & el : this->map) {
+        for (const auto & el : this->get_layout().offsets) {
           if (set.erase(el.first) > 0) {
             // if n exists in set, then 1 is returned and n is erased;
             // otherwise, 0.
@@ -565,6 +649,12 @@ namespace rascal {
       }
 
      private:
+      //! position of the block of skey in data
+      size_t get_position(const SortedKey_t & skey) const {
+        return this->global_offset +
+               this->get_layout().offsets.at(skey.get_key());
+      }
+
       /**
        * Functor to get a key from a map
        */
@@ -597,6 +687,8 @@ namespace rascal {
     using Keys_t = std::set<Key_t>;
     using SortedKey_t = internal::SortedKey<Key_t>;
     using InputData_t = internal::InternallySortedKeyMap<Key_t, Matrix_t>;
+    using Layout_t = typename InputData_t::Layout_t;
+    using Layouts_t = typename InputData_t::Layouts_t;
     using Data_t = Eigen::Array<Precision_t, Eigen::Dynamic, 1>;
     using Maps_t = std::vector<InputData_t>;
     // using Data_t = std::vector<InputData_t>;
@@ -606,7 +698,17 @@ namespace rascal {
 
    protected:
     Data_t values{};
+    /**
+     * memory actually holding the entries: values, a segment of arena or
+     * backing_file
+     */
+    Eigen::Map<Data_t> storage{nullptr, 0};
     Maps_t maps{};
+    /**
+     * distinct sets of keys of the entries, the first one is empty. Each
+     * entry of maps only stores the position of its layout in this table.
+     */
+    Layouts_t layouts = Layouts_t(1);
     std::string type_id;
     /**
      * boolean deciding on including the ghost atoms in the sizing of the
@@ -619,6 +721,20 @@ namespace rascal {
     //! record the global key_hash if has_uniform_keys == true
     size_t global_key_hash{0};
 
+    /**
+     * Buffer shared with other properties (e.g. the ones of the managers of
+     * a ManagerCollection) holding the entries when the property has been
+     * attached to it. values is left empty in that case.
+     */
+    std::shared_ptr<Data_t> arena{};
+
+    /**
+     * if not empty, the entries are stored in a memory mapped file created
+     * in this directory instead of values
+     */
+    std::string backing_directory{};
+    std::shared_ptr<MappedFile> backing_file{};
+
    public:
     //! constructor
     BlockSparseProperty(Manager_t & manager,
@@ -666,6 +782,26 @@ namespace rascal {
     //! return info about the type
     const std::string & get_type_info() const final { return this->type_id; }
 
+    /**
+     * Bytes of the values, the entries and the key layouts. The values held
+     * by a ManagerCollection arena or a backing file are not included.
+     */
+    size_t get_memory_usage() const final {
+      using KeyElement_t = typename Key_t::value_type;
+      using Offset_t = std::pair<Key_t, size_t>;
+      size_t n_bytes{sizeof(*this) + this->type_id.capacity() +
+                     this->values.size() * sizeof(Precision_t) +
+                     this->maps.capacity() * sizeof(InputData_t) +
+                     this->layouts.capacity() * sizeof(Layout_t)};
+      for (const auto & layout : this->layouts) {
+        n_bytes += layout.offsets.capacity() * sizeof(Offset_t);
+        for (const auto & el : layout.offsets) {
+          n_bytes += el.first.capacity() * sizeof(KeyElement_t);
+        }
+      }
+      return n_bytes;
+    }
+
     /**
      * Adjust size of maps to match the number of entries of the manager
      *
@@ -679,23 +815,28 @@ namespace rascal {
      */
     template <size_t Order__ = Order, std::enable_if_t<(Order__ > 1), int> = 0>
     void resize() {
+      this->detach_arena();
       size_t new_size{this->base_manager.nb_clusters(Order)};
-      this->maps.resize(new_size, std::move(InputData_t(this->values)));
+      this->maps.resize(new_size,
+                        InputData_t(this->storage, this->layouts));
     }
 
     //! Adjust size of maps to match the number of entries of the manager
     template <size_t Order__ = Order, std::enable_if_t<(Order__ == 0), int> = 0>
     void resize() {
-      this->maps.resize(1, std::move(InputData_t(this->values)));
+      this->detach_arena();
+      this->maps.resize(1, InputData_t(this->storage, this->layouts));
     }
 
     //! Adjust size of maps to match the number of entries of the manager
     template <size_t Order__ = Order, std::enable_if_t<(Order__ == 1), int> = 0>
     void resize() {
+      this->detach_arena();
       size_t new_size{this->exclude_ghosts
                           ? this->get_manager().size()
                           : this->get_manager().size_with_ghosts()};
-      this->maps.resize(new_size, std::move(InputData_t(this->values)));
+      this->maps.resize(new_size,
+                        InputData_t(this->storage, this->layouts));
     }
 
     /**
@@ -723,15 +864,15 @@ namespace rascal {
                 << "' != '" << this->size() << "'.";
         throw std::runtime_error(err_str.str());
       }
-      int n_row{this->get_nb_row()};
-      int n_col{this->get_nb_col()};
+      LayoutIds_t layout_ids{this->reset_layouts()};
       size_t global_offset{0};
       for (size_t i_map{0}; i_map < this->size(); i_map++) {
-        this->maps[i_map].resize_view(keys_list[i_map], n_row, n_col,
-                                      global_offset);
+        size_t layout_id{
+            this->intern_layout(this->sort_keys(keys_list[i_map]), layout_ids)};
+        this->maps[i_map].set_layout(layout_id, global_offset);
         global_offset += this->maps[i_map].size();
       }
-      this->values.resize(global_offset);
+      this->allocate(global_offset);
 
       // check if the keys are the same across cluster entries
       this->check_for_uniform_keys();
@@ -752,14 +893,14 @@ namespace rascal {
     template <typename... Args>
     void resize(const std::set<Args...> & keys) {
       this->resize();
-      int n_row{this->get_nb_row()};
-      int n_col{this->get_nb_col()};
+      LayoutIds_t layout_ids{this->reset_layouts()};
+      size_t layout_id{this->intern_layout(this->sort_keys(keys), layout_ids)};
       size_t global_offset{0};
       for (size_t i_map{0}; i_map < this->size(); i_map++) {
-        this->maps[i_map].resize_view(keys, n_row, n_col, global_offset);
+        this->maps[i_map].set_layout(layout_id, global_offset);
         global_offset += this->maps[i_map].size();
       }
-      this->values.resize(global_offset);
+      this->allocate(global_offset);
 
       // check if the keys are the same across cluster entries
       this->check_for_uniform_keys();
@@ -770,10 +911,12 @@ namespace rascal {
     void check_for_uniform_keys() {
       if (this->maps.size() > 0) {
         this->has_uniform_keys = true;
+        const size_t layout_id{this->maps[0].get_layout_id()};
         this->global_key_hash = this->maps[0].get_key_hash();
         for (const auto & map : this->maps) {
-          if (this->global_key_hash != map.get_key_hash()) {
+          if (layout_id != map.get_layout_id()) {
             this->has_uniform_keys = false;
+            break;
           }
         }
       } else {
@@ -781,7 +924,10 @@ namespace rascal {
       }
     }
 
-    void setZero() { this->values = 0.; }
+    //! number of distinct sets of keys of the entries (including no keys)
+    size_t get_nb_layouts() const { return this->layouts.size(); }
+
+    void setZero() { this->storage.setZero(); }
 
     size_t size() const { return this->maps.size(); }
 
@@ -796,7 +942,9 @@ namespace rascal {
     //! clear all the content of the property
     void clear() {
       // this->values.resize(0);
+      this->detach_arena();
       this->maps.clear();
+      this->layouts.resize(1);
     }
 
     Manager_t & get_manager() {
@@ -899,6 +1047,10 @@ namespace rascal {
      * missing entries are filled with zeros.
      * The features are flattened out following the underlying storage order.
      *
+     * When all the entries have the same keys the storage is already a dense
+     * matrix (see get_raw_data_view) and it is copied one block of columns
+     * per key.
+     *
      * @param features dense Eigen matrix of the proper size
      *
      * @param all_keys set of all the keys that should be considered when
@@ -908,6 +1060,19 @@ namespace rascal {
     void fill_dense_feature_matrix(Eigen::Ref<Matrix_t> features,
                                    const Keys_t & all_keys) const {
       int inner_size{this->get_nb_comp()};
+      if (this->are_keys_uniform()) {
+        const auto raw_data = this->get_raw_data_view();
+        int i_feat{0};
+        for (const auto & key : all_keys) {
+          if (this->maps[0].count(key) == 1) {
+            auto info = this->get_block_info_by_key(key);
+            features.block(0, i_feat, info[2], info[3]) =
+                raw_data.block(info[0], info[1], info[2], info[3]);
+          }
+          i_feat += inner_size;
+        }
+        return;
+      }
       int i_row{0};
       size_t n_center{this->maps.size()};
       for (size_t i_center{0}; i_center < n_center; i_center++) {
@@ -948,13 +1113,25 @@ namespace rascal {
     }
 
     Matrix_t get_features_gradient(const Keys_t & all_keys) {
-      static_assert(Order_ == 2, "Gradients are a property of order 2.");
-      using ConstMapSoapGradFlat_t = const Eigen::Map<
-          const Eigen::Matrix<double, ThreeD, Eigen::Dynamic, Eigen::RowMajor>>;
       size_t n_elements{this->size() * ThreeD};
       int inner_size{this->get_nb_comp() / ThreeD};
       Matrix_t features =
           Matrix_t::Zero(n_elements, inner_size * all_keys.size());
+      this->fill_dense_feature_gradient_matrix(features, all_keys);
+      return features;
+    }
+
+    /**
+     * Fill a dense gradient matrix with layout (ThreeD * Npairs) x Nfeatures
+     * (see get_features_gradient). As in fill_dense_feature_matrix, the
+     * entries missing a key of all_keys are left untouched.
+     */
+    void fill_dense_feature_gradient_matrix(Eigen::Ref<Matrix_t> features,
+                                            const Keys_t & all_keys) const {
+      static_assert(Order_ == 2, "Gradients are a property of order 2.");
+      using ConstMapSoapGradFlat_t = const Eigen::Map<
+          const Eigen::Matrix<double, ThreeD, Eigen::Dynamic, Eigen::RowMajor>>;
+      int inner_size{this->get_nb_comp() / ThreeD};
       int i_row_global{0};
       size_t n_pairs{this->maps.size()};
       for (size_t i_pair{0}; i_pair < n_pairs; i_pair++) {
@@ -972,7 +1149,6 @@ namespace rascal {
         }  // keys
         i_row_global += ThreeD;
       }  // centers
-      return features;
     }
 
     /**
@@ -980,11 +1156,17 @@ namespace rascal {
      */
     Keys_t get_keys() const {
       Keys_t all_keys{};
-      size_t n_center{this->maps.size()};
-      for (size_t i_center{0}; i_center < n_center; i_center++) {
-        auto keys = this->maps[i_center].get_keys();
-        for (auto & key : keys) {
-          all_keys.insert(key);
+      std::vector<bool> is_used(this->layouts.size(), false);
+      for (const auto & map : this->maps) {
+        is_used[map.get_layout_id()] = true;
+      }
+      for (size_t layout_id{0}; layout_id < this->layouts.size();
+           ++layout_id) {
+        if (not is_used[layout_id]) {
+          continue;
+        }
+        for (const auto & el : this->layouts[layout_id].offsets) {
+          all_keys.insert(el.first);
         }
       }
       return all_keys;
@@ -1015,8 +1197,110 @@ namespace rascal {
         throw std::runtime_error("The raw data is not a dense matrix.");
       }
       auto && n_row = this->size();
-      auto && n_col = this->values.size() / this->size();
-      return MatrixMapConst_Ref_t(this->values.data(), n_row, n_col);
+      auto && n_col = this->storage.size() / this->size();
+      return MatrixMapConst_Ref_t(this->storage.data(), n_row, n_col);
+    }
+
+    /**
+     * Read-only view of the whole storage, valid whether the keys are uniform
+     * or not. Entry i_entry starts at get_entry_offsets()[i_entry] and its
+     * blocks follow the layout get_layouts()[get_entry_layout_ids()[i_entry]].
+     */
+    const Eigen::Map<const Data_t> get_storage_view() const {
+      return Eigen::Map<const Data_t>(this->storage.data(),
+                                      this->storage.size());
+    }
+
+    //! position of each entry in get_storage_view
+    std::vector<size_t> get_entry_offsets() const {
+      std::vector<size_t> offsets{};
+      offsets.reserve(this->maps.size());
+      for (const auto & map : this->maps) {
+        offsets.push_back(map.get_global_offset());
+      }
+      return offsets;
+    }
+
+    //! layout of each entry in the table of get_layouts
+    std::vector<size_t> get_entry_layout_ids() const {
+      std::vector<size_t> layout_ids{};
+      layout_ids.reserve(this->maps.size());
+      for (const auto & map : this->maps) {
+        layout_ids.push_back(map.get_layout_id());
+      }
+      return layout_ids;
+    }
+
+    //! table of the distinct keys and block positions of the entries
+    const Layouts_t & get_layouts() const { return this->layouts; }
+
+    /**
+     * Move the entries in arena, as a dense block of size() rows starting at
+     * offset, following the layout of all_keys. The keys missing from an
+     * entry are filled with zeros, as in fill_dense_feature_matrix, so that
+     * afterwards all entries have the keys all_keys and the block is the
+     * dense feature matrix of the property.
+     *
+     * The property stays a view of arena until it is resized or cleared,
+     * e.g. when it is recomputed.
+     */
+    void attach_arena(std::shared_ptr<Data_t> arena, size_t offset,
+                      const Keys_t & all_keys) {
+      const size_t n_entries{this->size()};
+      const size_t n_col{all_keys.size() *
+                         static_cast<size_t>(this->get_nb_comp())};
+      if (offset + n_entries * n_col > static_cast<size_t>(arena->size())) {
+        std::stringstream err_str{};
+        err_str << "The arena is too small to hold the property: '"
+                << arena->size() << "' < '" << offset + n_entries * n_col
+                << "'.";
+        throw std::runtime_error(err_str.str());
+      }
+      MatrixMap_Ref_t block(arena->data() + offset, n_entries, n_col);
+      if (arena == this->arena) {
+        // the current entries may overlap with the destination
+        Matrix_t features = Matrix_t::Zero(n_entries, n_col);
+        this->fill_dense_feature_matrix(features, all_keys);
+        block = features;
+      } else {
+        block.setZero();
+        this->fill_dense_feature_matrix(block, all_keys);
+      }
+
+      LayoutIds_t layout_ids{this->reset_layouts()};
+      size_t layout_id{
+          this->intern_layout(this->sort_keys(all_keys), layout_ids)};
+      for (size_t i_map{0}; i_map < n_entries; i_map++) {
+        this->maps[i_map].set_layout(layout_id, i_map * n_col);
+      }
+      this->bind_storage(arena->data() + offset, n_entries * n_col);
+      this->arena = std::move(arena);
+      this->values.resize(0);
+      this->backing_file.reset();
+
+      this->check_for_uniform_keys();
+    }
+
+    //! buffer holding the entries if the property is attached to one
+    const std::shared_ptr<Data_t> & get_arena() const { return this->arena; }
+
+    /**
+     * Store the entries in a memory mapped file created in directory from
+     * the next resize on, so that properties larger than the memory are
+     * paged to the disk by the OS. The file is removed when the property
+     * releases it. An empty directory goes back to storing them in memory.
+     */
+    void set_backing_directory(const std::string & directory) {
+      this->backing_directory = directory;
+    }
+
+    const std::string & get_backing_directory() const {
+      return this->backing_directory;
+    }
+
+    //! file holding the entries, null if they are stored in memory
+    const std::shared_ptr<MappedFile> & get_backing_file() const {
+      return this->backing_file;
     }
 
     std::array<int, 4> get_block_info_by_key(const Key_t & key) const {
@@ -1037,10 +1321,10 @@ namespace rascal {
       return arr;
     }
 
-    double sum() const { return this->values.sum(); }
+    double sum() const { return this->storage.sum(); }
 
     double l1_norm() const {
-      return this->values.matrix().template lpNorm<1>();
+      return this->storage.matrix().template lpNorm<1>();
     }
 
     /**
@@ -1131,6 +1415,117 @@ namespace rascal {
       }
       return mat;
     }
+
+   protected:
+    //! point the entries to size values starting at data
+    void bind_storage(Precision_t * data, size_t size) {
+      // rebinding a Map is done by placement new, see the Eigen doc
+      new (&this->storage) Eigen::Map<Data_t>(data, size);
+    }
+
+    /**
+     * Make room for size values in values or in backing_file, their content
+     * is not kept.
+     */
+    void allocate(size_t size) {
+      if (this->backing_directory.empty()) {
+        this->values.resize(size);
+        this->bind_storage(this->values.data(), size);
+        this->backing_file.reset();
+      } else {
+        if (not this->backing_file or
+            this->backing_file->get_directory() != this->backing_directory) {
+          this->bind_storage(nullptr, 0);
+          this->backing_file =
+              std::make_shared<MappedFile>(this->backing_directory);
+        }
+        this->backing_file->resize(size * sizeof(Precision_t));
+        this->bind_storage(
+            static_cast<Precision_t *>(this->backing_file->data()), size);
+        this->values.resize(0);
+      }
+    }
+
+    /**
+     * Go back to storing the entries in values or backing_file. The entries
+     * referring to the arena are dropped since their content is not kept.
+     */
+    void detach_arena() {
+      if (this->arena) {
+        this->maps.clear();
+        this->arena.reset();
+        this->bind_storage(nullptr, 0);
+      }
+    }
+
+    //! index of the layouts by their sorted keys
+    using LayoutIds_t = std::map<std::vector<Key_t>, size_t>;
+
+    //! keep only the empty layout and return its index
+    LayoutIds_t reset_layouts() {
+      this->layouts.resize(1);
+      LayoutIds_t layout_ids{};
+      layout_ids.emplace(std::vector<Key_t>{}, 0);
+      return layout_ids;
+    }
+
+    /**
+     * Keys with their elements sorted, in ascending order. Keys_List is a stl
+     * container of Key_t, the use of std::set garantees the order of the
+     * keys.
+     */
+    template <template <typename...> class Keys_List, typename... Args>
+    static std::vector<Key_t>
+    sort_keys(const Keys_List<Key_t, Args...> & keys) {
+      std::set<SortedKey_t, internal::CompareSortedKeyLess> skeys{};
+      for (auto && key : keys) {
+        skeys.insert(SortedKey_t{key});
+      }
+      return sort_keys(skeys);
+    }
+
+    template <typename... Args>
+    static std::vector<Key_t>
+    sort_keys(const std::set<SortedKey_t, Args...> & skeys) {
+      std::vector<Key_t> sorted_keys{};
+      sorted_keys.reserve(skeys.size());
+      for (auto && skey : skeys) {
+        sorted_keys.push_back(skey.get_key());
+      }
+      return sorted_keys;
+    }
+
+    /**
+     * Position of the layout of sorted_keys in this->layouts, the layout is
+     * added to the table if no other entry has the same keys.
+     */
+    size_t intern_layout(std::vector<Key_t> && sorted_keys,
+                         LayoutIds_t & layout_ids) {
+      auto it{layout_ids.find(sorted_keys)};
+      if (it != layout_ids.end()) {
+        return it->second;
+      }
+      Layout_t layout{};
+      layout.n_row = this->get_nb_row();
+      layout.n_col = this->get_nb_col();
+      const size_t block_size{static_cast<size_t>(layout.n_row * layout.n_col)};
+      layout.offsets.reserve(sorted_keys.size());
+      Key_t flat_keys{};
+      for (const auto & key : sorted_keys) {
+        layout.offsets[key] = layout.total_length;
+        layout.total_length += block_size;
+        for (const auto & el : key) {
+          flat_keys.emplace_back(el);
+        }
+      }
+      // compute a hash of the keys
+      internal::Hash<Key_t> hasher{};
+      layout.key_hash = hasher(flat_keys);
+      this->layouts.push_back(std::move(layout));
+      const size_t layout_id{this->layouts.size() - 1};
+      layout_ids.emplace(std::move(sorted_keys), layout_id);
+      return layout_id;
+    }
   };
 
 }  // namespace rascal
@@ -162,6 +162,8 @@ namespace rascal {
     using Self_t = TypedProperty<T, Order_, Manager>;
     using traits = typename Manager::traits;
     using Matrix_t = math::Matrix_t;
+    using RawDataView_t = const Eigen::Map<const Eigen::Matrix<
+        T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>;
 
     using value_type = typename Value_t::value_type;
     using reference = typename Value_t::reference;
@@ -204,6 +206,11 @@ namespace rascal {
     //! return info about the type
     const std::string & get_type_info() const { return this->type_id; }
 
+    size_t get_memory_usage() const final {
+      return sizeof(*this) + this->values.capacity() * sizeof(T) +
+             this->type_id.capacity();
+    }
+
     Manager_t & get_manager() {
       return static_cast<Manager_t &>(this->base_manager);
     }
@@ -336,6 +343,16 @@ namespace rascal {
       return features;
     }
 
+    /**
+     * Read-only view of the values as the get_nb_item() x get_nb_comp()
+     * matrix of get_features, without copying them. The view is invalidated
+     * when the property is resized.
+     */
+    RawDataView_t get_raw_data_view() const {
+      return RawDataView_t(this->values.data(), this->get_nb_item(),
+                           this->get_nb_comp());
+    }
+
    protected:
     std::string type_id;
     std::vector<T> values{};  //!< storage for properties
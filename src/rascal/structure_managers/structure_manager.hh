@@ -48,7 +48,10 @@
 #include <array>
 #include <cstddef>
 #include <limits>
+#include <map>
+#include <numeric>
 #include <sstream>
+#include <string>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -147,6 +150,34 @@ namespace rascal {
             std::move(make_individual_property<PropertyTypes>(manager))...);
       }
     };
+
+    //! detects managers that can list their neighbours sorted by distance
+    template <class, class = void_t<>>
+    struct has_sorted_by_distance : std::false_type {};
+
+    template <class Manager>
+    struct has_sorted_by_distance<
+        Manager,
+        void_t<decltype(std::declval<Manager>().get_sorted_by_distance())>>
+        : std::true_type {};
+
+    template <class Manager>
+    std::enable_if_t<has_sorted_by_distance<Manager>::value,
+                     AdaptorTraits::SortedByDistance>
+    get_sorted_by_distance(const Manager & manager) {
+      return manager.get_sorted_by_distance();
+    }
+
+    /**
+     * Managers that do not expose the ordering of their neighbours are
+     * assumed unsorted
+     */
+    template <class Manager>
+    std::enable_if_t<not has_sorted_by_distance<Manager>::value,
+                     AdaptorTraits::SortedByDistance>
+    get_sorted_by_distance(const Manager & /*manager*/) {
+      return AdaptorTraits::SortedByDistance::no;
+    }
   }  // namespace internal
 
   /* ---------------------------------------------------------------------- */
@@ -401,6 +432,8 @@ namespace rascal {
      *
      * @tparam UserProperty_t the user property type
      * @param name the name of the property to create.
+     * @param lifetime transient properties are released by
+     * release_transient_property and sweep_properties
      *
      * @throw runtime_error if property with name does already exist
      * @return reference of to `UserProperty`
@@ -409,7 +442,9 @@ namespace rascal {
     template <typename UserProperty_t>
     UserProperty_t &
     create_property(const std::string & name, const bool exclude_ghosts = false,
-                    const std::string & metadata = "no metadata") {
+                    const std::string & metadata = "no metadata",
+                    const PropertyLifetime lifetime =
+                        PropertyLifetime::Persistent) {
       if (this->is_property_in_stack(name)) {
         std::stringstream error{};
         error << "A property of name '" << name
@@ -419,6 +454,7 @@ namespace rascal {
       } else {
         auto property{std::make_shared<UserProperty_t>(
             this->implementation(), metadata, exclude_ghosts)};
+        property->set_lifetime(lifetime);
         this->properties[name] = property;
         return *property;
       }
@@ -489,7 +525,8 @@ namespace rascal {
      * this case.
      * @param exclude_ghosts change property sizing behavior when Order == 1
      * and when the property does not already exist.
-
+     * @param lifetime lifetime of the property if it is created, the
+     * lifetime of an existing property is left untouched
      *
      * @throw runtime_error If validate_property is true and UserProperty_t is
      * not compatible with the property with the given name.
@@ -501,7 +538,9 @@ namespace rascal {
     get_property(const std::string & name, const bool validate_property = true,
                  const bool force_creation = false,
                  const bool exclude_ghosts = false,
-                 const std::string & metadata = "no metadata") {
+                 const std::string & metadata = "no metadata",
+                 const PropertyLifetime lifetime =
+                     PropertyLifetime::Persistent) {
       bool is_property_in_stack{this->is_property_in_stack(name)};
       if (is_property_in_stack) {
         return this->template forward_get_property_request<UserProperty_t>(
@@ -509,6 +548,7 @@ namespace rascal {
       } else if (not(is_property_in_stack) && force_creation) {
         auto property{std::make_shared<UserProperty_t>(
             this->implementation(), metadata, exclude_ghosts)};
+        property->set_lifetime(lifetime);
         this->properties[name] = property;
         return property;
       } else {
@@ -554,6 +594,86 @@ namespace rascal {
       }
     }
 
+    /**
+     * Removes the property `name` from the layer of the stack holding it if
+     * it is transient. It is meant to be called by a calculator once it does
+     * not need the intermediate property anymore.
+     *
+     * @return true if the property has been released
+     */
+    template <bool IsRoot = IsRootImplementation,
+              std::enable_if_t<IsRoot, int> = 0>
+    bool release_transient_property(const std::string & name) {
+      return this->release_layer_transient_property(name);
+    }
+
+    template <bool IsRoot = IsRootImplementation,
+              std::enable_if_t<not(IsRoot), int> = 0>
+    bool release_transient_property(const std::string & name) {
+      if (this->is_property_in_current_level(name)) {
+        return this->release_layer_transient_property(name);
+      }
+      return this->get_previous_manager()->release_transient_property(name);
+    }
+
+    /**
+     * Removes from the whole stack the transient properties and the stale
+     * ones, i.e. the properties that are not up to date with the structure
+     * anymore and that are not referenced outside of the manager.
+     *
+     * @return the number of properties released
+     */
+    template <bool IsRoot = IsRootImplementation,
+              std::enable_if_t<IsRoot, int> = 0>
+    size_t sweep_properties() {
+      return this->sweep_layer_properties();
+    }
+
+    template <bool IsRoot = IsRootImplementation,
+              std::enable_if_t<not(IsRoot), int> = 0>
+    size_t sweep_properties() {
+      return this->sweep_layer_properties() +
+             this->get_previous_manager()->sweep_properties();
+    }
+
+    /**
+     * Bytes held by the properties of the stack, from this layer down to the
+     * root, by property name. The cluster indices of each layer are reported
+     * under "cluster_indices " followed by the name of the layer.
+     */
+    std::map<std::string, size_t> get_memory_usage_by_property() const {
+      std::map<std::string, size_t> usage{};
+      this->add_memory_usage(usage);
+      return usage;
+    }
+
+    //! total number of bytes held by the properties of the stack
+    size_t get_memory_usage() const {
+      size_t n_bytes{0};
+      for (const auto & element : this->get_memory_usage_by_property()) {
+        n_bytes += element.second;
+      }
+      return n_bytes;
+    }
+
+    /**
+     * Adds the memory used by the properties of this layer and the layers
+     * below to usage. It is public because each structure manager needs to
+     * call it on the previous manager.
+     */
+    template <bool IsRoot = IsRootImplementation,
+              std::enable_if_t<IsRoot, int> = 0>
+    void add_memory_usage(std::map<std::string, size_t> & usage) const {
+      this->add_layer_memory_usage(usage);
+    }
+
+    template <bool IsRoot = IsRootImplementation,
+              std::enable_if_t<not(IsRoot), int> = 0>
+    void add_memory_usage(std::map<std::string, size_t> & usage) const {
+      this->add_layer_memory_usage(usage);
+      this->get_previous_manager()->add_memory_usage(usage);
+    }
+
     /**
      * Forwards property requests to lower layers. Usually to get a property
      * the `get_propertp_ptr` or `get_property_ref` function should be used.
@@ -801,6 +921,53 @@ namespace rascal {
     std::array<size_t, 1> get_counters() const {
       return std::array<size_t, 1>{};
     }
+    //! release_transient_property restricted to this layer
+    bool release_layer_transient_property(const std::string & name) {
+      auto element = this->properties.find(name);
+      if (element == this->properties.end() or
+          not element->second->is_transient()) {
+        return false;
+      }
+      this->properties.erase(element);
+      return true;
+    }
+
+    //! sweep_properties restricted to this layer
+    size_t sweep_layer_properties() {
+      size_t n_released{0};
+      for (auto element = this->properties.begin();
+           element != this->properties.end();) {
+        auto & property{element->second};
+        bool is_stale{not property->is_updated() and property.use_count() == 1};
+        if (property->is_transient() or is_stale) {
+          element = this->properties.erase(element);
+          ++n_released;
+        } else {
+          ++element;
+        }
+      }
+      return n_released;
+    }
+
+    //! memory used by the properties and the cluster indices of this layer
+    void add_layer_memory_usage(std::map<std::string, size_t> & usage) const {
+      for (const auto & element : this->properties) {
+        usage[element.first] += element.second->get_memory_usage();
+      }
+      usage[std::string("cluster_indices ") + this->get_name()] +=
+          this->get_cluster_indices_memory_usage(std::make_index_sequence<
+              std::tuple_size<ClusterIndex_t>::value>{});
+    }
+
+    template <size_t... Orders>
+    size_t
+    get_cluster_indices_memory_usage(std::index_sequence<Orders...>) const {
+      std::array<size_t, sizeof...(Orders)> n_bytes{
+          {std::get<Orders>(this->cluster_indices_container)
+               .get_memory_usage()...}};
+      return std::accumulate(n_bytes.begin(), n_bytes.end(), size_t{0});
+    }
+
     //! access to cluster_indices_container
     ClusterIndex_t & get_cluster_indices_container() {
       return this->cluster_indices_container;
@@ -35,8 +35,14 @@
 #include "rascal/structure_managers/structure_manager.hh"
 #include "rascal/structure_managers/updateable_base.hh"
 #include "rascal/utils/json_io.hh"
+#include "rascal/utils/parallel.hh"
 #include "rascal/utils/utils.hh"
 
+#include <array>
+#include <map>
+#include <memory>
+#include <sstream>
+
 namespace rascal {
 
   /**
@@ -72,10 +78,27 @@ namespace rascal {
     using Data_t = std::vector<ManagerPtr_t>;
     using value_type = typename Data_t::value_type;
     using Matrix_t = math::Matrix_t;
+    using MatrixMapConst_t = Eigen::Map<const Matrix_t>;
+    using Arena_t = Eigen::Array<double, Eigen::Dynamic, 1>;
 
    protected:
+    /**
+     * Contiguous storage of a representation of all the managers, see
+     * make_arena.
+     */
+    struct Arena {
+      std::shared_ptr<Arena_t> data{};
+      //! shape of the feature matrix held by data
+      Eigen::Index n_rows{0};
+      Eigen::Index n_cols{0};
+      //! keys associated with the columns, in order
+      json keys{};
+    };
+
     Data_t managers{};
     Hypers_t adaptor_parameters{};
+    //! arenas of the collection by property name
+    std::map<std::string, Arena> arenas{};
 
    public:
     ManagerCollection() = default;
@@ -272,6 +295,51 @@ namespace rascal {
       return this->managers[index]->get_shared_ptr();
     }
 
+    /**
+     * Bytes held by the properties of the managers (see
+     * StructureManager::get_memory_usage) and by the arenas of the
+     * collection
+     */
+    size_t get_memory_usage() const {
+      size_t n_bytes{0};
+      for (const auto & manager : this->managers) {
+        n_bytes += manager->get_memory_usage();
+      }
+      for (const auto & arena : this->arenas) {
+        n_bytes += arena.second.data->size() * sizeof(double);
+      }
+      return n_bytes;
+    }
+
+    /**
+     * Releases the transient and the stale properties of every structure
+     * (see StructureManager::sweep_properties) and the arenas that lost
+     * their property in one of the structures.
+     *
+     * @return the number of properties released
+     */
+    size_t sweep_properties() {
+      size_t n_released{0};
+      for (auto & manager : this->managers) {
+        n_released += manager->sweep_properties();
+      }
+      for (auto arena = this->arenas.begin(); arena != this->arenas.end();) {
+        bool is_released{false};
+        for (auto & manager : this->managers) {
+          if (not manager->is_property_in_stack(arena->first)) {
+            is_released = true;
+            break;
+          }
+        }
+        if (is_released) {
+          arena = this->arenas.erase(arena);
+        } else {
+          ++arena;
+        }
+      }
+      return n_released;
+    }
+
     /**
      * get the dense feature matrix associated with the property built
      * with calculator in the elements of the manager collection.
@@ -287,18 +355,164 @@ namespace rascal {
 
       auto property_name{this->get_calculator_name(calculator, false)};
 
+      if (this->template has_arena<Prop_t>(property_name)) {
+        return this->template get_arena_view<Prop_t>(property_name);
+      }
+
+      auto properties{this->template get_properties<Prop_t>(property_name)};
+      auto shape{FeatureMatrixHelper<Prop_t>::get_shape(properties)};
+      Matrix_t features(shape[0], shape[1]);
+      FeatureMatrixHelper<Prop_t>::fill(properties, features, 1);
+      return features;
+    }
+
+    /**
+     * Shape of the feature matrix of get_features, e.g. to allocate the
+     * buffer given to fill_features.
+     */
+    template <class Calculator>
+    std::array<size_t, 2> get_features_shape(const Calculator & calculator) {
+      using Prop_t = typename Calculator::template Property_t<Manager_t>;
+      return FeatureMatrixHelper<Prop_t>::get_shape(
+          this->template get_properties<Prop_t>(
+              this->get_calculator_name(calculator, false)));
+    }
+
+    /**
+     * Writes the feature matrix of get_features in features, e.g. a numpy
+     * array, instead of allocating a new matrix. The row offsets of the
+     * managers are computed first, then the managers are split in n_threads
+     * groups filling their own rows concurrently.
+     *
+     * @throw runtime_error if features does not have the shape given by
+     * get_features_shape
+     */
+    template <class Calculator>
+    void fill_features(const Calculator & calculator,
+                       Eigen::Ref<Matrix_t> features, size_t n_threads = 1) {
+      using Prop_t = typename Calculator::template Property_t<Manager_t>;
+      this->template fill_property_features<Prop_t>(
+          this->get_calculator_name(calculator, false), features, n_threads);
+    }
+
+    //! shape of the gradients matrix filled by fill_features_gradient
+    template <class Calculator>
+    std::array<size_t, 2>
+    get_features_gradient_shape(const Calculator & calculator) {
+      using Prop_t =
+          typename Calculator::template PropertyGradient_t<Manager_t>;
+      return FeatureMatrixHelper<Prop_t>::get_shape(
+          this->template get_properties<Prop_t>(
+              this->get_calculator_name(calculator, true)));
+    }
+
+    /**
+     * Writes the gradients of the features with respect to the positions in
+     * features, 3 rows per pair (see
+     * BlockSparseProperty::get_features_gradient), like fill_features.
+     */
+    template <class Calculator>
+    void fill_features_gradient(const Calculator & calculator,
+                                Eigen::Ref<Matrix_t> features,
+                                size_t n_threads = 1) {
+      using Prop_t =
+          typename Calculator::template PropertyGradient_t<Manager_t>;
+      this->template fill_property_features<Prop_t>(
+          this->get_calculator_name(calculator, true), features, n_threads);
+    }
+
+    /**
+     * Arena mode: gather the representation computed with calculator in one
+     * contiguous buffer owned by the collection. The property of each manager
+     * becomes a view of its rows of the feature matrix, which contains the
+     * keys present in the collection (the missing ones are set to zero), so
+     * get_features_view does not copy anything and the kernels between
+     * collections reduce to one matrix product.
+     *
+     * Should only be used if calculator has BlockSparseProperty. A property
+     * leaves the arena when it is recomputed, e.g. after an update of its
+     * manager, and make_arena has to be called again.
+     */
+    template <class Calculator>
+    void make_arena(const Calculator & calculator) {
+      using Prop_t = typename Calculator::template Property_t<Manager_t>;
+
+      auto property_name{this->get_calculator_name(calculator, false)};
+      auto all_keys{this->get_keys(calculator)};
+
       auto && property_ =
           *managers[0]->template get_property<Prop_t>(property_name);
-      // assume inner_size is consistent for all managers
-      int inner_size{property_.get_nb_comp()};
+      Arena arena{};
+      arena.n_rows = this->get_number_of_elements(calculator);
+      arena.n_cols = all_keys.size() * property_.get_nb_comp();
+      arena.keys = all_keys;
+      arena.data = std::make_shared<Arena_t>(arena.n_rows * arena.n_cols);
+
+      size_t offset{0};
+      for (auto & manager : this->managers) {
+        auto && property =
+            *manager->template get_property<Prop_t>(property_name);
+        property.attach_arena(arena.data, offset, all_keys);
+        offset += property.size() * arena.n_cols;
+      }
+      this->arenas[property_name] = std::move(arena);
+    }
+
+    /**
+     * @return true if all the properties called property_name are still
+     * views of the arena of the collection
+     */
+    template <class Prop_t>
+    bool has_arena(const std::string & property_name) const {
+      auto arena_it{this->arenas.find(property_name)};
+      if (arena_it == this->arenas.end()) {
+        return false;
+      }
+      for (auto & manager : this->managers) {
+        if (not manager->is_property_in_stack(property_name)) {
+          return false;
+        }
+        auto property{
+            manager->template get_property<Prop_t>(property_name, false)};
+        if (not FeatureMatrixHelper<Prop_t>::is_in_arena(
+                *property, arena_it->second.data)) {
+          return false;
+        }
+      }
+      return true;
+    }
 
-      Matrix_t features{};
+    /**
+     * @return the feature matrix stored in the arena of property_name
+     * @throw runtime_error if has_arena is false
+     */
+    template <class Prop_t>
+    MatrixMapConst_t get_arena_view(const std::string & property_name) const {
+      if (not this->template has_arena<Prop_t>(property_name)) {
+        std::stringstream error{};
+        error << "The property '" << property_name
+              << "' is not stored in an arena of the collection";
+        throw std::runtime_error(error.str());
+      }
+      auto && arena{this->arenas.at(property_name)};
+      return MatrixMapConst_t(arena.data->data(), arena.n_rows, arena.n_cols);
+    }
 
-      auto n_rows{this->get_number_of_elements(calculator, false)};
+    //! keys associated with the columns of the arena of property_name
+    const json & get_arena_keys(const std::string & property_name) const {
+      return this->arenas.at(property_name).keys;
+    }
 
-      FeatureMatrixHelper<Prop_t>::apply(this->managers, property_name,
-                                         features, n_rows, inner_size);
-      return features;
+    /**
+     * Zero-copy version of get_features, the view is valid as long as the
+     * representation is not recomputed.
+     *
+     * @throw runtime_error if make_arena has not been called with calculator
+     */
+    template <class Calculator>
+    MatrixMapConst_t get_features_view(const Calculator & calculator) const {
+      using Prop_t = typename Calculator::template Property_t<Manager_t>;
+      return this->template get_arena_view<Prop_t>(calculator.get_name());
     }
 
     /**
@@ -369,10 +583,41 @@ namespace rascal {
     }
 
    protected:
+    //! the property property_name of each manager
+    template <class Prop_t>
+    std::vector<std::shared_ptr<Prop_t>>
+    get_properties(const std::string & property_name) {
+      std::vector<std::shared_ptr<Prop_t>> properties{};
+      properties.reserve(this->managers.size());
+      for (auto & manager : this->managers) {
+        properties.push_back(
+            manager->template get_property<Prop_t>(property_name));
+      }
+      return properties;
+    }
+
+    template <class Prop_t>
+    void fill_property_features(const std::string & property_name,
+                                Eigen::Ref<Matrix_t> features,
+                                size_t n_threads) {
+      auto properties{this->template get_properties<Prop_t>(property_name)};
+      auto shape{FeatureMatrixHelper<Prop_t>::get_shape(properties)};
+      if (static_cast<size_t>(features.rows()) != shape[0] or
+          static_cast<size_t>(features.cols()) != shape[1]) {
+        std::stringstream error{};
+        error << "The feature matrix of '" << property_name << "' has shape ("
+              << shape[0] << ", " << shape[1] << ") but the buffer has shape ("
+              << features.rows() << ", " << features.cols() << ")";
+        throw std::runtime_error(error.str());
+      }
+      FeatureMatrixHelper<Prop_t>::fill(properties, features, n_threads);
+    }
+
     /**
      * Helper classes to deal with the differentiation between Property and
      * BlockSparseProperty when filling the feature matrix.
-     * Fills a feature matrix with the properties contained in managers.
+     * Fills a feature matrix with the properties of the managers, each
+     * property filling its own block of rows.
      */
     template <typename T>
     struct FeatureMatrixHelper {};
@@ -380,21 +625,37 @@ namespace rascal {
     template <typename T, size_t Order, int NbRow, int NbCol>
     struct FeatureMatrixHelper<Property<T, Order, Manager_t, NbRow, NbCol>> {
       using Prop_t = Property<T, Order, Manager_t, NbRow, NbCol>;
-      template <class StructureManagers, class Matrix>
-      static void apply(StructureManagers & managers,
-                        const std::string & property_name, Matrix & features,
-                        int n_rows, int inner_size) {
-        features.resize(n_rows, inner_size);
-        features.setZero();
-        int i_row{0};
-        for (auto & manager : managers) {
-          auto && property =
-              *manager->template get_property<Prop_t>(property_name);
-          auto n_rows_manager = property.get_nb_item();
-          property.fill_dense_feature_matrix(
-              features.block(i_row, 0, n_rows_manager, inner_size));
-          i_row += n_rows_manager;
+      using Properties_t = std::vector<std::shared_ptr<Prop_t>>;
+
+      static std::array<size_t, 2> get_shape(const Properties_t & properties) {
+        std::array<size_t, 2> shape{{0, 0}};
+        for (const auto & property : properties) {
+          shape[0] += property->get_nb_item();
+          // assume inner_size is consistent for all managers
+          shape[1] = property->get_nb_comp();
+        }
+        return shape;
+      }
+
+      static void fill(const Properties_t & properties,
+                       Eigen::Ref<Matrix_t> features, size_t n_threads) {
+        std::vector<size_t> row_offsets{0};
+        for (const auto & property : properties) {
+          row_offsets.push_back(row_offsets.back() + property->get_nb_item());
         }
+        internal::parallel_for(
+            properties.size(), n_threads, [&](size_t i_property) {
+              auto && rows{features.middleRows(
+                  row_offsets[i_property],
+                  row_offsets[i_property + 1] - row_offsets[i_property])};
+              properties[i_property]->fill_dense_feature_matrix(rows);
+            });
+      }
+
+      //! Property has no arena mode
+      static bool is_in_arena(const Prop_t & /*property*/,
+                              const std::shared_ptr<Arena_t> & /*arena*/) {
+        return false;
       }
     };
 
@@ -402,36 +663,73 @@ namespace rascal {
     struct FeatureMatrixHelper<BlockSparseProperty<T, Order, Manager_t, Key>> {
       using Prop_t = BlockSparseProperty<T, Order, Manager_t, Key>;
       using Keys_t = typename Prop_t::Keys_t;
+      using Properties_t = std::vector<std::shared_ptr<Prop_t>>;
+      //! the gradients (Order == 2) have one row per direction
+      constexpr static size_t RowsPerEntry{Order == 2 ? ThreeD : 1};
 
-      /**
-       * Fill features matrix with the representation labeled with
-       * property_name present in managers using the keys in present in the
-       * accross the managers.
-       */
-      template <class StructureManagers, class Matrix>
-      static void apply(StructureManagers & managers,
-                        const std::string & property_name, Matrix & features,
-                        int n_rows, int inner_size) {
+      //! the keys present accross the managers, i.e. the columns
+      static Keys_t get_all_keys(const Properties_t & properties) {
         Keys_t all_keys{};
-        for (auto & manager : managers) {
-          auto && property =
-              *manager->template get_property<Prop_t>(property_name);
-          auto keys = property.get_keys();
+        for (const auto & property : properties) {
+          auto keys = property->get_keys();
           all_keys.insert(keys.begin(), keys.end());
         }
+        return all_keys;
+      }
 
-        size_t n_cols{all_keys.size() * inner_size};
-        features.resize(n_rows, n_cols);
-        features.setZero();
-        int i_row{0};
-        for (auto & manager : managers) {
-          auto && property =
-              *manager->template get_property<Prop_t>(property_name);
-          auto n_rows_manager = property.size();
-          property.fill_dense_feature_matrix(
-              features.block(i_row, 0, n_rows_manager, n_cols), all_keys);
-          i_row += n_rows_manager;
+      static std::array<size_t, 2> get_shape(const Properties_t & properties) {
+        std::array<size_t, 2> shape{{0, 0}};
+        for (const auto & property : properties) {
+          shape[0] += property->size() * RowsPerEntry;
+        }
+        if (not properties.empty()) {
+          // assume inner_size is consistent for all managers
+          size_t inner_size{properties[0]->get_nb_comp() / RowsPerEntry};
+          shape[1] = get_all_keys(properties).size() * inner_size;
+        }
+        return shape;
+      }
+
+      /**
+       * Fill features with the representation of properties using the keys
+       * present accross the managers, the missing ones are set to zero.
+       */
+      static void fill(const Properties_t & properties,
+                       Eigen::Ref<Matrix_t> features, size_t n_threads) {
+        const Keys_t all_keys{get_all_keys(properties)};
+        std::vector<size_t> row_offsets{0};
+        for (const auto & property : properties) {
+          row_offsets.push_back(row_offsets.back() +
+                                property->size() * RowsPerEntry);
         }
+        internal::parallel_for(
+            properties.size(), n_threads, [&](size_t i_property) {
+              auto && rows{features.middleRows(
+                  row_offsets[i_property],
+                  row_offsets[i_property + 1] - row_offsets[i_property])};
+              rows.setZero();
+              fill_rows(*properties[i_property], rows, all_keys);
+            });
+      }
+
+      template <size_t Order_ = Order, std::enable_if_t<(Order_ == 1), int> = 0>
+      static void fill_rows(const Prop_t & property,
+                            Eigen::Ref<Matrix_t> rows,
+                            const Keys_t & all_keys) {
+        property.fill_dense_feature_matrix(rows, all_keys);
+      }
+
+      template <size_t Order_ = Order, std::enable_if_t<(Order_ == 2), int> = 0>
+      static void fill_rows(const Prop_t & property,
+                            Eigen::Ref<Matrix_t> rows,
+                            const Keys_t & all_keys) {
+        property.fill_dense_feature_gradient_matrix(rows, all_keys);
+      }
+
+      //! is property a view of arena
+      static bool is_in_arena(const Prop_t & property,
+                              const std::shared_ptr<Arena_t> & arena) {
+        return property.get_arena() == arena;
       }
     };
   };
@@ -0,0 +1,123 @@
+/**
+ * @file   rascal/utils/instrumentation.cc
+ *
+ * @author  Felix Musil <felix.musil@epfl.ch>
+ *
+ * @date   18 October 2026
+ *
+ * @brief Implementation of the timers and counters
+ *
+ * Copyright  2026  Felix Musil, COSMO (EPFL), LAMMM (EPFL)
+ *
+ * Rascal is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3, or (at
+ * your option) any later version.
+ *
+ * Rascal is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file LICENSE. If not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#include "rascal/utils/instrumentation.hh"
+
+#include <atomic>
+#include <map>
+#include <mutex>  // NOLINT
+
+namespace rascal {
+  namespace instrumentation {
+    namespace {
+      struct Timer {
+        double seconds{0.};
+        size_t calls{0};
+      };
+
+      struct Records {
+        std::atomic<bool> is_enabled{false};
+        std::mutex mutex{};
+        std::map<std::string, Timer> timers{};
+        std::map<std::string, size_t> counters{};
+      };
+
+      //! constructed on first use to avoid static initialization issues
+      Records & get_records() {
+        static Records records{};
+        return records;
+      }
+    }  // namespace
+
+    /* ---------------------------------------------------------------------- */
+    void enable(bool is_enabled) { get_records().is_enabled = is_enabled; }
+
+    /* ---------------------------------------------------------------------- */
+    bool is_enabled() { return get_records().is_enabled; }
+
+    /* ---------------------------------------------------------------------- */
+    void reset() {
+      auto & records{get_records()};
+      std::lock_guard<std::mutex> lock{records.mutex};
+      records.timers.clear();
+      records.counters.clear();
+    }
+
+    /* ---------------------------------------------------------------------- */
+    void add_time(const std::string & name, double seconds) {
+      auto & records{get_records()};
+      if (not records.is_enabled) {
+        return;
+      }
+      std::lock_guard<std::mutex> lock{records.mutex};
+      auto & timer{records.timers[name]};
+      timer.seconds += seconds;
+      ++timer.calls;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    void add_count(const std::string & name, size_t count) {
+      auto & records{get_records()};
+      if (not records.is_enabled) {
+        return;
+      }
+      std::lock_guard<std::mutex> lock{records.mutex};
+      records.counters[name] += count;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    json get_report() {
+      auto & records{get_records()};
+      std::lock_guard<std::mutex> lock{records.mutex};
+      json report{{"timers", json::object()}, {"counters", json::object()}};
+      for (const auto & timer : records.timers) {
+        report["timers"][timer.first] = {{"seconds", timer.second.seconds},
+                                         {"calls", timer.second.calls}};
+      }
+      for (const auto & counter : records.counters) {
+        report["counters"][counter.first] = counter.second;
+      }
+      return report;
+    }
+
+    /* ---------------------------------------------------------------------- */
+    ScopedTimer::ScopedTimer(const char * name)
+        : name{is_enabled() ? name : nullptr} {
+      if (this->name != nullptr) {
+        this->start = Clock_t::now();
+      }
+    }
+
+    /* ---------------------------------------------------------------------- */
+    ScopedTimer::~ScopedTimer() {
+      if (this->name != nullptr) {
+        std::chrono::duration<double> elapsed{Clock_t::now() - this->start};
+        add_time(this->name, elapsed.count());
+      }
+    }
+  }  // namespace instrumentation
+}  // namespace rascal
@@ -0,0 +1,100 @@
+/**
+ * @file   rascal/utils/instrumentation.hh
+ *
+ * @author  Felix Musil <felix.musil@epfl.ch>
+ *
+ * @date   18 October 2026
+ *
+ * @brief Optional timers and counters of the main computation steps
+ *
+ * Copyright  2026  Felix Musil, COSMO (EPFL), LAMMM (EPFL)
+ *
+ * Rascal is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3, or (at
+ * your option) any later version.
+ *
+ * Rascal is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file LICENSE. If not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef SRC_RASCAL_UTILS_INSTRUMENTATION_HH_
+#define SRC_RASCAL_UTILS_INSTRUMENTATION_HH_
+
+#include "rascal/utils/json_io.hh"
+
+#include <chrono>  // NOLINT
+#include <cstddef>
+#include <string>
+
+namespace rascal {
+  /**
+   * Process wide timers and counters of the main steps of a calculation
+   * (neighbour list, expansion, invariants, kernels...). They are disabled
+   * by default so that the instrumented code only pays for one check of
+   * is_enabled per step. The records are protected by a mutex and can be
+   * updated from several threads.
+   */
+  namespace instrumentation {
+    //! start (or stop) recording the timers and counters
+    void enable(bool is_enabled = true);
+
+    bool is_enabled();
+
+    //! forget all the records
+    void reset();
+
+    //! add seconds to the timer name and increment its number of calls
+    void add_time(const std::string & name, double seconds);
+
+    //! add count to the counter name
+    void add_count(const std::string & name, size_t count = 1);
+
+    /**
+     * @return the records as
+     * {"timers": {name: {"seconds": ..., "calls": ...}, ...},
+     *  "counters": {name: count, ...}}
+     */
+    json get_report();
+
+    /**
+     * Times its scope with the timer name if the instrumentation is enabled
+     * when it is created.
+     */
+    class ScopedTimer {
+     public:
+      using Clock_t = std::chrono::steady_clock;
+
+      explicit ScopedTimer(const char * name);
+
+      //! Copy constructor
+      ScopedTimer(const ScopedTimer & other) = delete;
+
+      //! Move constructor
+      ScopedTimer(ScopedTimer && other) = delete;
+
+      //! Destructor, records the elapsed time
+      ~ScopedTimer();
+
+      //! Copy assignment operator
+      ScopedTimer & operator=(const ScopedTimer & other) = delete;
+
+      //! Move assignment operator
+      ScopedTimer & operator=(ScopedTimer && other) = delete;
+
+     protected:
+      //! null if the instrumentation is disabled
+      const char * name;
+      Clock_t::time_point start{};
+    };
+  }  // namespace instrumentation
+}  // namespace rascal
+
+#endif  // SRC_RASCAL_UTILS_INSTRUMENTATION_HH_
@@ -0,0 +1,98 @@
+/**
+ * @file   rascal/utils/mapped_file.cc
+ *
+ * @author  Felix Musil <felix.musil@epfl.ch>
+ *
+ * @date   18 October 2026
+ *
+ * @brief Implementation of the memory mapped temporary file
+ *
+ * Copyright  2026  Felix Musil, COSMO (EPFL), LAMMM (EPFL)
+ *
+ * Rascal is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3, or (at
+ * your option) any later version.
+ *
+ * Rascal is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file LICENSE. If not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#include "rascal/utils/mapped_file.hh"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace rascal {
+
+  MappedFile::MappedFile(const std::string & directory)
+      : directory{directory} {
+    std::string pattern{directory + "/rascal_mapped_XXXXXX"};
+    std::vector<char> filename(pattern.begin(), pattern.end());
+    filename.push_back('\0');
+    this->file_descriptor = mkstemp(filename.data());
+    if (this->file_descriptor == -1) {
+      std::stringstream error{};
+      error << "Could not create a file in '" << directory
+            << "': " << std::strerror(errno);
+      throw std::runtime_error(error.str());
+    }
+    // the file stays accessible through the descriptor only
+    unlink(filename.data());
+  }
+
+  /* ---------------------------------------------------------------------- */
+  MappedFile::~MappedFile() {
+    this->unmap();
+    close(this->file_descriptor);
+  }
+
+  /* ---------------------------------------------------------------------- */
+  void MappedFile::resize(size_t n_bytes) {
+    if (n_bytes == this->n_bytes) {
+      return;
+    }
+    this->unmap();
+    if (ftruncate(this->file_descriptor, static_cast<off_t>(n_bytes)) != 0) {
+      std::stringstream error{};
+      error << "Could not resize the mapped file to " << n_bytes
+            << " bytes: " << std::strerror(errno);
+      throw std::runtime_error(error.str());
+    }
+    if (n_bytes > 0) {
+      void * address{mmap(nullptr, n_bytes, PROT_READ | PROT_WRITE,
+                          MAP_SHARED, this->file_descriptor, 0)};
+      if (address == MAP_FAILED) {
+        std::stringstream error{};
+        error << "Could not map " << n_bytes
+              << " bytes of the file: " << std::strerror(errno);
+        throw std::runtime_error(error.str());
+      }
+      this->address = address;
+    }
+    this->n_bytes = n_bytes;
+  }
+
+  /* ---------------------------------------------------------------------- */
+  void MappedFile::unmap() {
+    if (this->address != nullptr) {
+      munmap(this->address, this->n_bytes);
+      this->address = nullptr;
+    }
+    this->n_bytes = 0;
+  }
+
+}  // namespace rascal
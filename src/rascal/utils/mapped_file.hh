@@ -0,0 +1,93 @@
+/**
+ * @file   rascal/utils/mapped_file.hh
+ *
+ * @author  Felix Musil <felix.musil@epfl.ch>
+ *
+ * @date   18 October 2026
+ *
+ * @brief Temporary file mapped in memory to hold large arrays
+ *
+ * Copyright  2026  Felix Musil, COSMO (EPFL), LAMMM (EPFL)
+ *
+ * Rascal is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3, or (at
+ * your option) any later version.
+ *
+ * Rascal is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file LICENSE. If not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef SRC_RASCAL_UTILS_MAPPED_FILE_HH_
+#define SRC_RASCAL_UTILS_MAPPED_FILE_HH_
+
+#include <cstddef>
+#include <string>
+
+namespace rascal {
+  /**
+   * Memory backed by a file instead of the swap, so that arrays larger than
+   * the RAM can be used: the OS writes the pages back to the file and reads
+   * them again on demand.
+   *
+   * The file is created in the given directory and unlinked right away, it
+   * is therefore removed from the disk once the object is destroyed (or the
+   * process ends).
+   */
+  class MappedFile {
+   public:
+    //! create an empty file in directory
+    explicit MappedFile(const std::string & directory);
+
+    //! Copy constructor
+    MappedFile(const MappedFile & other) = delete;
+
+    //! Move constructor
+    MappedFile(MappedFile && other) = delete;
+
+    //! Destructor
+    ~MappedFile();
+
+    //! Copy assignment operator
+    MappedFile & operator=(const MappedFile & other) = delete;
+
+    //! Move assignment operator
+    MappedFile & operator=(MappedFile && other) = delete;
+
+    /**
+     * Change the size of the file to n_bytes. The content is kept up to the
+     * new size, the additional bytes are zero, but the address of the
+     * mapping can change.
+     */
+    void resize(size_t n_bytes);
+
+    //! start of the mapping, null if the file is empty
+    void * data() { return this->address; }
+    const void * data() const { return this->address; }
+
+    //! size of the file in bytes
+    size_t size() const { return this->n_bytes; }
+
+    //! directory in which the file has been created
+    const std::string & get_directory() const { return this->directory; }
+
+   protected:
+    //! remove the current mapping if any
+    void unmap();
+
+    std::string directory;
+    int file_descriptor{-1};
+    void * address{nullptr};
+    size_t n_bytes{0};
+  };
+
+}  // namespace rascal
+
+#endif  // SRC_RASCAL_UTILS_MAPPED_FILE_HH_
@@ -0,0 +1,81 @@
+/**
+ * @file   rascal/utils/parallel.hh
+ *
+ * @author  Felix Musil <felix.musil@epfl.ch>
+ *
+ * @date   18 October 2026
+ *
+ * @brief Minimal thread based parallel loop
+ *
+ * Copyright  2026  Felix Musil, COSMO (EPFL), LAMMM (EPFL)
+ *
+ * Rascal is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3, or (at
+ * your option) any later version.
+ *
+ * Rascal is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this software; see the file LICENSE. If not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef SRC_RASCAL_UTILS_PARALLEL_HH_
+#define SRC_RASCAL_UTILS_PARALLEL_HH_
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>  // NOLINT
+#include <vector>
+
+namespace rascal {
+  namespace internal {
+    /**
+     * Calls func(index) for index in [0, n_items), the range being split in
+     * n_threads contiguous chunks processed concurrently. The calling thread
+     * processes the first chunk and n_threads <= 1 runs serially.
+     *
+     * func is responsible for only writing data owned by its index. The first
+     * exception thrown by a chunk is rethrown once all the chunks are done.
+     */
+    template <class Func>
+    void parallel_for(size_t n_items, size_t n_threads, const Func & func) {
+      n_threads = std::max<size_t>(1, std::min(n_threads, n_items));
+      std::vector<std::exception_ptr> errors(n_threads);
+      auto process_chunk = [&](size_t i_thread) {
+        size_t begin{i_thread * n_items / n_threads};
+        size_t end{(i_thread + 1) * n_items / n_threads};
+        try {
+          for (size_t index{begin}; index < end; ++index) {
+            func(index);
+          }
+        } catch (...) {
+          errors[i_thread] = std::current_exception();
+        }
+      };
+
+      std::vector<std::thread> threads{};
+      threads.reserve(n_threads - 1);
+      for (size_t i_thread{1}; i_thread < n_threads; ++i_thread) {
+        threads.emplace_back(process_chunk, i_thread);
+      }
+      process_chunk(0);
+      for (auto & thread : threads) {
+        thread.join();
+      }
+      for (auto & error : errors) {
+        if (error) {
+          std::rethrow_exception(error);
+        }
+      }
+    }
+  }  // namespace internal
+}  // namespace rascal
+
+#endif  // SRC_RASCAL_UTILS_PARALLEL_HH_
@@ -146,6 +146,26 @@ class TestSphericalInvariantsRepresentation(unittest.TestCase):
         kk = dot(X_t, X_t)
         self.assertTrue(np.allclose(kk, kk_ref))
 
+    def test_structure_features_view(self):
+        rep = SphericalInvariants(**self.hypers)
+        features = rep.transform(self.frames)
+        X = features.get_features(rep)
+
+        i_row = 0
+        for i_structure in range(len(self.frames)):
+            view = features.get_structure_features_view(rep, i_structure)
+            layout = features.get_structure_features_layout(rep, i_structure)
+            self.assertFalse(view.flags.writeable)
+            # the entries of the centers are the rows of the feature matrix
+            for offset, layout_id in zip(layout['entry_offsets'],
+                                         layout['layout_ids']):
+                entry_size = layout['layouts'][layout_id]['entry_size']
+                entry = view[offset:offset + entry_size]
+                self.assertTrue(np.allclose(np.linalg.norm(entry),
+                                            np.linalg.norm(X[i_row])))
+                i_row += 1
+        self.assertEqual(i_row, X.shape[0])
+
     def test_serialization(self):
         rep = SphericalInvariants(**self.hypers)
 
@@ -30,9 +30,12 @@
 #include "test_adaptor.hh"
 #include "test_structure.hh"
 
+#include "rascal/structure_managers/flat_pair_list.hh"
+
 #include <boost/mpl/list.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
 #include <vector>
 
 namespace rascal {
@@ -157,6 +160,107 @@ namespace rascal {
     }
   }
 
+  /* ---------------------------------------------------------------------- */
+  /**
+   * Test that the neighbours of a strict adaptor sorted by distance come by
+   * increasing distance and are the same as the ones of the unsorted adaptor
+   */
+  BOOST_FIXTURE_TEST_CASE_TEMPLATE(sorted_by_distance_test, Fix,
+                                   multiple_fixtures, Fix) {
+    auto && managers = Fix::managers;
+    for (auto & manager : managers) {
+      double cutoff{manager->get_cutoff()};
+      auto adaptor_strict{make_adapted_manager<AdaptorStrict>(manager, cutoff)};
+      adaptor_strict->update();
+      auto adaptor_sorted{
+          make_adapted_manager<AdaptorStrict>(manager, cutoff, true)};
+      adaptor_sorted->update();
+
+      BOOST_CHECK(adaptor_strict->get_sorted_by_distance() ==
+                  AdaptorTraits::SortedByDistance::no);
+      BOOST_CHECK(adaptor_sorted->get_sorted_by_distance() ==
+                  AdaptorTraits::SortedByDistance::yes);
+      BOOST_CHECK_EQUAL(adaptor_strict->get_nb_clusters(2),
+                        adaptor_sorted->get_nb_clusters(2));
+
+      std::vector<std::vector<int>> neighbours{};
+      for (auto atom : adaptor_strict) {
+        neighbours.emplace_back();
+        for (auto pair : atom.pairs_with_self_pair()) {
+          neighbours.back().push_back(pair.back());
+        }
+        std::sort(neighbours.back().begin(), neighbours.back().end());
+      }
+
+      size_t i_atom{0};
+      for (auto atom : adaptor_sorted) {
+        std::vector<int> neighbours_sorted{};
+        double previous_distance{0.};
+        for (auto pair : atom.pairs_with_self_pair()) {
+          const double & distance{adaptor_sorted->get_distance(pair)};
+          BOOST_CHECK_LE(previous_distance, distance);
+          previous_distance = distance;
+          neighbours_sorted.push_back(pair.back());
+        }
+        std::sort(neighbours_sorted.begin(), neighbours_sorted.end());
+        BOOST_CHECK_EQUAL_COLLECTIONS(
+            neighbours[i_atom].begin(), neighbours[i_atom].end(),
+            neighbours_sorted.begin(), neighbours_sorted.end());
+        ++i_atom;
+      }
+    }
+  }
+
+  /* ---------------------------------------------------------------------- */
+  /**
+   * Test that the flat pair list holds the pairs of the iteration over the
+   * strict adaptor, center by center
+   */
+  BOOST_FIXTURE_TEST_CASE_TEMPLATE(flat_pair_list_test, Fix, multiple_fixtures,
+                                   Fix) {
+    auto && managers = Fix::managers;
+    FlatPairList pair_list{};
+    for (auto & manager : managers) {
+      double cutoff{manager->get_cutoff()};
+      auto adaptor_strict{make_adapted_manager<AdaptorStrict>(manager, cutoff)};
+      adaptor_strict->update();
+      // the same list is refilled for each structure
+      pair_list.update(adaptor_strict);
+      auto directions = pair_list.get_directions();
+
+      BOOST_CHECK_EQUAL(pair_list.get_nb_centers(), adaptor_strict->size());
+      BOOST_REQUIRE_EQUAL(pair_list.center_offsets.size(),
+                          adaptor_strict->size() + 1);
+      size_t i_center{0}, i_pair{0};
+      for (auto center : adaptor_strict) {
+        BOOST_CHECK_EQUAL(pair_list.center_offsets[i_center], i_pair);
+        BOOST_CHECK_EQUAL(pair_list.center_indices[i_center],
+                          adaptor_strict->get_offset(center));
+        BOOST_CHECK_EQUAL(pair_list.center_species[i_center],
+                          center.get_atom_type());
+        for (auto neigh : center.pairs()) {
+          BOOST_REQUIRE_LT(i_pair, pair_list.size());
+          BOOST_CHECK_EQUAL(pair_list.pair_indices[i_pair],
+                            adaptor_strict->get_offset(neigh));
+          BOOST_CHECK_EQUAL(pair_list.neighbour_atom_indices[i_pair],
+                            adaptor_strict->get_atom_index(
+                                neigh.get_internal_neighbour_atom_tag()));
+          BOOST_CHECK_EQUAL(pair_list.neighbour_species[i_pair],
+                            neigh.get_atom_type());
+          BOOST_CHECK_EQUAL(pair_list.distances[i_pair],
+                            adaptor_strict->get_distance(neigh));
+          auto direction = adaptor_strict->get_direction_vector(neigh);
+          BOOST_CHECK_EQUAL((directions.col(i_pair) - direction).norm(), 0.);
+          ++i_pair;
+        }
+        ++i_center;
+      }
+      BOOST_CHECK_EQUAL(pair_list.center_offsets.back(), i_pair);
+      BOOST_CHECK_EQUAL(pair_list.size(), i_pair);
+    }
+  }
+
+  /* ---------------------------------------------------------------------- */
   BOOST_FIXTURE_TEST_CASE_TEMPLATE(multiple_strict_test, Fix, multiple_fixtures,
                                    Fix) {
     bool verbose{false};
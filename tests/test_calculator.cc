@@ -327,6 +327,133 @@ namespace rascal {
   using grad_sparse_fixtures =
       boost::mpl::list<CalculatorFixture<ComplexHypersSphericalInvariants>>;
 
+  /**
+   * Test that the representation and its gradients stored in memory mapped
+   * files (backing_directory hyper) match the ones stored in memory
+   */
+  BOOST_FIXTURE_TEST_CASE_TEMPLATE(backing_directory_test, Fix,
+                                   grad_sparse_fixtures, Fix) {
+    using Manager_t = typename Fix::Manager_t;
+    using Representation_t = typename Fix::Representation_t;
+    using Prop_t = typename Representation_t::template Property_t<Manager_t>;
+    using PropGrad_t =
+        typename Representation_t::template PropertyGradient_t<Manager_t>;
+    auto & managers = Fix::managers;
+    auto & hypers = Fix::representation_hypers;
+
+    for (auto & manager : managers) {
+      for (auto & hyper : hypers) {
+        json hyper_mapped = hyper;
+        hyper_mapped["backing_directory"] = ".";
+        Representation_t representation{hyper};
+        Representation_t representation_mapped{hyper_mapped};
+        BOOST_CHECK_EQUAL(representation_mapped.get_backing_directory(), ".");
+        representation.compute(manager);
+        representation_mapped.compute(manager);
+
+        auto && prop{*manager->template get_property<Prop_t>(
+            representation.get_name(), true)};
+        auto && prop_mapped{*manager->template get_property<Prop_t>(
+            representation_mapped.get_name(), true)};
+        BOOST_CHECK(prop.get_backing_file() == nullptr);
+        BOOST_CHECK(prop_mapped.get_backing_file() != nullptr);
+        math::Matrix_t diff = prop.get_features() - prop_mapped.get_features();
+        BOOST_CHECK_EQUAL(diff.norm(), 0.);
+
+        if (representation.does_gradients()) {
+          auto && prop_grad{*manager->template get_property<PropGrad_t>(
+              representation.get_gradient_name(), true)};
+          auto && prop_grad_mapped{*manager->template get_property<PropGrad_t>(
+              representation_mapped.get_gradient_name(), true)};
+          BOOST_CHECK(prop_grad_mapped.get_backing_file() != nullptr);
+          diff = prop_grad.get_features_gradient() -
+                 prop_grad_mapped.get_features_gradient();
+          BOOST_CHECK_EQUAL(diff.norm(), 0.);
+        }
+      }
+    }
+  }
+
+  /**
+   * Check that the representations show up in the memory usage of the
+   * managers and in the timers once the instrumentation is enabled.
+   */
+  BOOST_FIXTURE_TEST_CASE_TEMPLATE(instrumentation_test, Fix,
+                                   grad_sparse_fixtures, Fix) {
+    auto & managers = Fix::managers;
+    auto & hypers = Fix::representation_hypers;
+    using Representation_t = typename Fix::Representation_t;
+
+    instrumentation::reset();
+    instrumentation::enable();
+    for (auto & manager : managers) {
+      for (auto & hyper : hypers) {
+        Representation_t representation{hyper};
+        size_t n_bytes_before{manager->get_memory_usage()};
+        representation.compute(manager);
+        auto usage = manager->get_memory_usage_by_property();
+        BOOST_REQUIRE(usage.count(representation.get_name()) == 1);
+        BOOST_CHECK_GT(usage[representation.get_name()], 0);
+        BOOST_CHECK_GT(manager->get_memory_usage(), n_bytes_before);
+      }
+    }
+    instrumentation::enable(false);
+
+    json report = instrumentation::get_report();
+    BOOST_REQUIRE(not report["timers"].empty());
+    for (auto & timer : report["timers"]) {
+      BOOST_CHECK_GT(timer["calls"].template get<size_t>(), 0);
+      BOOST_CHECK_GE(timer["seconds"].template get<double>(), 0.);
+    }
+    instrumentation::reset();
+    BOOST_CHECK(instrumentation::get_report()["timers"].empty());
+  }
+
+  /**
+   * Test that the spherical expansion computed as an intermediate of the
+   * invariants is released, unless it was computed beforehand, and that the
+   * stale properties are swept.
+   */
+  BOOST_FIXTURE_TEST_CASE_TEMPLATE(transient_expansion_test, Fix,
+                                   grad_sparse_fixtures, Fix) {
+    using Manager_t = typename Fix::Manager_t;
+    using Representation_t = typename Fix::Representation_t;
+    using Prop_t = typename Representation_t::template Property_t<Manager_t>;
+    using PropExp_t =
+        typename CalculatorSphericalExpansion::template Property_t<Manager_t>;
+    auto & managers = Fix::managers;
+    auto & hypers = Fix::representation_hypers;
+
+    for (auto & manager : managers) {
+      for (auto & hyper : hypers) {
+        Representation_t representation{hyper};
+        CalculatorSphericalExpansion expansion{hyper};
+        representation.compute(manager);
+        BOOST_CHECK(not manager->is_property_in_stack(expansion.get_name()));
+        BOOST_CHECK(
+            not manager->is_property_in_stack(expansion.get_gradient_name()));
+        auto && soap_vectors{*manager->template get_property<Prop_t>(
+            representation.get_name(), true)};
+        BOOST_CHECK(soap_vectors.is_updated());
+
+        // an expansion attached by the user is kept
+        expansion.compute(manager);
+        soap_vectors.set_updated_status(false);
+        representation.compute(manager);
+        BOOST_CHECK(soap_vectors.is_updated());
+        auto && coefficients{*manager->template get_property<PropExp_t>(
+            expansion.get_name(), true)};
+        BOOST_CHECK(not coefficients.is_transient());
+
+        // only the up to date invariants survive the sweep
+        coefficients.set_updated_status(false);
+        BOOST_CHECK_GE(manager->sweep_properties(), 1);
+        BOOST_CHECK(not manager->is_property_in_stack(expansion.get_name()));
+        BOOST_CHECK(manager->is_property_in_stack(representation.get_name()));
+      }
+    }
+  }
+
   /**
    * Test if the keys for the PowerSpectrum's gradient are properly sparse on
    * the 1st center of CaCrP2O7_mvc-11955_symmetrized.json
@@ -423,6 +550,285 @@ namespace rascal {
     }
   }
 
+  /* ---------------------------------------------------------------------- */
+  /**
+   * Test that with global_species all the centers share one dense set of
+   * keys, in the expansion and in the invariants, and that the dense copy of
+   * the features matches the entries key by key.
+   */
+  BOOST_FIXTURE_TEST_CASE_TEMPLATE(uniform_keys_test, Fix, grad_sparse_fixtures,
+                                   Fix) {
+    using Manager_t = typename Fix::Manager_t;
+    using Representation_t = typename Fix::Representation_t;
+    using Prop_t = typename Representation_t::template Property_t<Manager_t>;
+    using PropExp_t =
+        typename CalculatorSphericalExpansion::Property_t<Manager_t>;
+    using Keys_t = typename Prop_t::Keys_t;
+
+    auto & managers = Fix::managers;
+    auto & hypers = Fix::representation_hypers;
+    const double delta{1e-10};
+    // assumes the structure is CaCrP2O7_mvc-11955_symmetrized.json
+    const std::vector<int> species{8, 15, 20, 24};
+
+    for (auto & manager : managers) {
+      for (auto & hyper : hypers) {
+        json hyper_ud = hyper;
+        hyper_ud["expansion_by_species_method"] = "user defined";
+        hyper_ud["global_species"] = species;
+        hyper_ud["compute_gradients"] = false;
+        json hyper_grad = hyper_ud;
+        hyper_grad["compute_gradients"] = true;
+
+        CalculatorSphericalExpansion expansion{hyper_ud};
+        expansion.compute(manager);
+        auto & coefficients{
+            *manager->template get_property<PropExp_t>(expansion.get_name())};
+        BOOST_CHECK(coefficients.are_keys_uniform());
+        // the empty layout and the one of global_species
+        BOOST_CHECK_EQUAL(coefficients.get_nb_layouts(), 2);
+
+        Representation_t representation{hyper_ud};
+        Representation_t representation_grad{hyper_grad};
+        representation.compute(manager);
+        representation_grad.compute(manager);
+        auto & soap{*manager->template get_property<Prop_t>(
+            representation.get_name())};
+        auto & soap_grad{*manager->template get_property<Prop_t>(
+            representation_grad.get_name())};
+        BOOST_CHECK(soap.are_keys_uniform());
+        double rel_err{math::relative_error(soap.get_features(),
+                                            soap_grad.get_features(), delta)
+                           .maxCoeff()};
+        BOOST_TEST(rel_err < delta);
+
+        // a key missing from the entries is left to zero
+        Keys_t keys{soap.get_keys()};
+        keys.insert({1, 1});
+        const int inner_size{soap.get_nb_comp()};
+        math::Matrix_t features = math::Matrix_t::Zero(
+            soap.size(), inner_size * static_cast<int>(keys.size()));
+        soap.fill_dense_feature_matrix(features, keys);
+        int i_center{0};
+        for (auto center : manager) {
+          int i_feat{0};
+          for (auto & key : keys) {
+            auto && block{features.block(i_center, i_feat, 1, inner_size)};
+            if (soap[center].count(key) == 1) {
+              auto && entry{soap[center][key]};
+              for (int i_pos{0}; i_pos < inner_size; ++i_pos) {
+                BOOST_CHECK_EQUAL(block(0, i_pos), entry(i_pos));
+              }
+            } else {
+              BOOST_CHECK_EQUAL(block.norm(), 0.);
+            }
+            i_feat += inner_size;
+          }
+          ++i_center;
+        }
+      }
+    }
+  }
+
+  /* ---------------------------------------------------------------------- */
+  /**
+   * Test the 'alchemical' expansion_by_species_method:
+   *  - an identity species_coupling gives the same features and gradients as
+   *    'user defined' (the mapping of the species to the channels preserves
+   *    the ordering of the keys)
+   *  - a compressed species_coupling gives expansion coefficients and
+   *    gradients that are the weighted sums of the 'user defined' ones
+   */
+  BOOST_FIXTURE_TEST_CASE_TEMPLATE(alchemical_expansion_test, Fix,
+                                   grad_sparse_fixtures, Fix) {
+    using Manager_t = typename Fix::Manager_t;
+    using Representation_t = typename Fix::Representation_t;
+    using Prop_t = typename Representation_t::template Property_t<Manager_t>;
+    using PropGrad_t =
+        typename Representation_t::template PropertyGradient_t<Manager_t>;
+    using PropExp_t =
+        typename CalculatorSphericalExpansion::Property_t<Manager_t>;
+    using PropGradExp_t =
+        typename CalculatorSphericalExpansion::PropertyGradient_t<Manager_t>;
+    using Key_t = typename CalculatorSphericalExpansion::Key_t;
+
+    auto & managers = Fix::managers;
+    auto & hypers = Fix::representation_hypers;
+    // relative error threshold
+    const double delta{1e-8};
+    // range of zero
+    const double epsilon{1e-11};
+    // assumes the structure is CaCrP2O7_mvc-11955_symmetrized.json
+    const std::vector<int> species{8, 15, 20, 24};
+    const std::vector<std::vector<double>> identity{
+        {1., 0., 0., 0.}, {0., 1., 0., 0.}, {0., 0., 1., 0.}, {0., 0., 0., 1.}};
+    const std::vector<std::vector<double>> compression{
+        {1., 0.}, {0.5, 0.5}, {0., 1.}, {-0.3, 0.7}};
+
+    for (auto & manager : managers) {
+      for (auto & hyper : hypers) {
+        json hyper_ud = hyper;
+        hyper_ud["expansion_by_species_method"] = "user defined";
+        hyper_ud["global_species"] = species;
+        json hyper_identity = hyper_ud;
+        hyper_identity["expansion_by_species_method"] = "alchemical";
+        hyper_identity["species_coupling"] = identity;
+        json hyper_compression = hyper_identity;
+        hyper_compression["species_coupling"] = compression;
+
+        // identity coupling
+        Representation_t representation_ud{hyper_ud};
+        Representation_t representation_identity{hyper_identity};
+        representation_ud.compute(manager);
+        representation_identity.compute(manager);
+        auto & rep_ud{*manager->template get_property<Prop_t>(
+            representation_ud.get_name())};
+        auto & rep_identity{*manager->template get_property<Prop_t>(
+            representation_identity.get_name())};
+        auto & rep_grad_ud{*manager->template get_property<PropGrad_t>(
+            representation_ud.get_gradient_name())};
+        auto & rep_grad_identity{*manager->template get_property<PropGrad_t>(
+            representation_identity.get_gradient_name())};
+
+        double rel_err{math::relative_error(rep_ud.get_features(),
+                                            rep_identity.get_features(), delta,
+                                            epsilon)
+                           .maxCoeff()};
+        BOOST_TEST(rel_err < delta);
+        rel_err = math::relative_error(rep_grad_ud.get_features_gradient(),
+                                       rep_grad_identity.get_features_gradient(),
+                                       delta, epsilon)
+                      .maxCoeff();
+        BOOST_TEST(rel_err < delta);
+
+        // compressed coupling
+        CalculatorSphericalExpansion expansion_ud{hyper_ud};
+        CalculatorSphericalExpansion expansion_compression{hyper_compression};
+        expansion_ud.compute(manager);
+        expansion_compression.compute(manager);
+        auto & exp_ud{*manager->template get_property<PropExp_t>(
+            expansion_ud.get_name())};
+        auto & exp_compression{*manager->template get_property<PropExp_t>(
+            expansion_compression.get_name())};
+        auto & exp_grad_ud{*manager->template get_property<PropGradExp_t>(
+            expansion_ud.get_gradient_name())};
+        auto & exp_grad_compression{
+            *manager->template get_property<PropGradExp_t>(
+                expansion_compression.get_gradient_name())};
+
+        for (auto center : manager) {
+          for (size_t i_pseudo{0}; i_pseudo < compression[0].size();
+               ++i_pseudo) {
+            Key_t pseudo_key{static_cast<int>(i_pseudo)};
+            math::Matrix_t ref{
+                math::Matrix_t::Zero(exp_ud.get_nb_row(),
+                                     exp_ud.get_nb_col())};
+            for (size_t i_sp{0}; i_sp < species.size(); ++i_sp) {
+              Key_t key{species[i_sp]};
+              if (exp_ud[center].count(key)) {
+                ref += compression[i_sp][i_pseudo] * exp_ud[center][key];
+              }
+            }
+            math::Matrix_t test{exp_compression[center][pseudo_key]};
+            rel_err = math::relative_error(ref, test, delta, epsilon)
+                          .maxCoeff();
+            BOOST_TEST(rel_err < delta);
+
+            for (auto neigh : center.pairs_with_self_pair()) {
+              math::Matrix_t ref_grad{
+                  math::Matrix_t::Zero(exp_grad_ud.get_nb_row(),
+                                       exp_grad_ud.get_nb_col())};
+              for (size_t i_sp{0}; i_sp < species.size(); ++i_sp) {
+                Key_t key{species[i_sp]};
+                if (exp_grad_ud[neigh].count(key)) {
+                  ref_grad +=
+                      compression[i_sp][i_pseudo] * exp_grad_ud[neigh][key];
+                }
+              }
+              math::Matrix_t test_grad{
+                  math::Matrix_t::Zero(exp_grad_ud.get_nb_row(),
+                                       exp_grad_ud.get_nb_col())};
+              if (exp_grad_compression[neigh].count(pseudo_key)) {
+                test_grad = exp_grad_compression[neigh][pseudo_key];
+              }
+              rel_err = math::relative_error(ref_grad, test_grad, delta,
+                                             epsilon)
+                            .maxCoeff();
+              BOOST_TEST(rel_err < delta);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  /* ---------------------------------------------------------------------- */
+  /**
+   * Test that restricting the gradients to gradient_atoms gives the same
+   * gradients wrt. the selected atoms and leaves the entries of the other
+   * centers empty
+   */
+  BOOST_FIXTURE_TEST_CASE_TEMPLATE(gradient_atoms_test, Fix,
+                                   grad_sparse_fixtures, Fix) {
+    using Manager_t = typename Fix::Manager_t;
+    using Representation_t = typename Fix::Representation_t;
+    using Prop_t = typename Representation_t::template Property_t<Manager_t>;
+    using PropGrad_t =
+        typename Representation_t::template PropertyGradient_t<Manager_t>;
+
+    auto & managers = Fix::managers;
+    auto & hypers = Fix::representation_hypers;
+    const double delta{1e-10};
+    const double epsilon{1e-14};
+    const std::set<int> gradient_atoms{0, 3, 5};
+
+    for (auto & manager : managers) {
+      for (auto & hyper : hypers) {
+        json hyper_subset = hyper;
+        hyper_subset["gradient_atoms"] = gradient_atoms;
+        Representation_t representation{hyper};
+        Representation_t representation_subset{hyper_subset};
+        representation.compute(manager);
+        representation_subset.compute(manager);
+        auto & rep{*manager->template get_property<Prop_t>(
+            representation.get_name())};
+        auto & rep_subset{*manager->template get_property<Prop_t>(
+            representation_subset.get_name())};
+        auto & rep_grad{*manager->template get_property<PropGrad_t>(
+            representation.get_gradient_name())};
+        auto & rep_grad_subset{*manager->template get_property<PropGrad_t>(
+            representation_subset.get_gradient_name())};
+
+        double rel_err{math::relative_error(rep.get_features(),
+                                            rep_subset.get_features(), delta,
+                                            epsilon)
+                           .maxCoeff()};
+        BOOST_TEST(rel_err < delta);
+
+        for (auto center : manager) {
+          const bool is_gradient_atom{
+              static_cast<bool>(gradient_atoms.count(center.get_atom_tag()))};
+          for (auto neigh : center.pairs_with_self_pair()) {
+            auto keys_subset = rep_grad_subset[neigh].get_keys();
+            if (not is_gradient_atom) {
+              BOOST_TEST(keys_subset.empty());
+              continue;
+            }
+            auto keys = rep_grad[neigh].get_keys();
+            BOOST_TEST(keys == keys_subset);
+            for (const auto & key : keys) {
+              math::Matrix_t ref{rep_grad[neigh][key]};
+              math::Matrix_t test{rep_grad_subset[neigh][key]};
+              rel_err =
+                  math::relative_error(ref, test, delta, epsilon).maxCoeff();
+              BOOST_TEST(rel_err < delta);
+            }
+          }
+        }
+      }
+    }
+  }
+
   /* ---------------------------------------------------------------------- */
   /**
    * Test if the representation computed is equal to a reference from a file
@@ -516,6 +922,619 @@ namespace rascal {
     }
   }
 
+  using contracted_basis_fixtures =
+      boost::mpl::list<CalculatorFixture<MultipleHypersSphericalExpansion>>;
+
+  /**
+   * Test that the expansion with max_angular == 0, which skips the spherical
+   * harmonics, and its gradients are the l = 0 channel of the full expansion
+   */
+  BOOST_FIXTURE_TEST_CASE_TEMPLATE(radial_only_expansion_test, Fix,
+                                   contracted_basis_fixtures, Fix) {
+    using Manager_t = typename Fix::Manager_t;
+    using Representation_t = typename Fix::Representation_t;
+    using Prop_t = typename Representation_t::template Property_t<Manager_t>;
+    using PropGrad_t =
+        typename Representation_t::template PropertyGradient_t<Manager_t>;
+
+    auto & managers = Fix::managers;
+    auto & hypers = Fix::representation_hypers;
+
+    for (auto & manager : managers) {
+      for (auto & hyper : hypers) {
+        auto & optimization_hypers =
+            hyper.at("radial_contribution").at("optimization");
+        // the splines of the two expansions are different so their errors too
+        double delta{1e-10};
+        if (optimization_hypers.at("type") == "Spline") {
+          delta =
+              100 * optimization_hypers.at("accuracy").template get<double>();
+        }
+        json hyper_radial = hyper;
+        hyper_radial["max_angular"] = 0;
+
+        Representation_t expansion{hyper};
+        Representation_t expansion_radial{hyper_radial};
+        expansion.compute(manager);
+        expansion_radial.compute(manager);
+        auto & exp{
+            *manager->template get_property<Prop_t>(expansion.get_name())};
+        auto & exp_radial{*manager->template get_property<Prop_t>(
+            expansion_radial.get_name())};
+        auto & exp_grad{*manager->template get_property<PropGrad_t>(
+            expansion.get_gradient_name())};
+        auto & exp_grad_radial{*manager->template get_property<PropGrad_t>(
+            expansion_radial.get_gradient_name())};
+
+        for (auto center : manager) {
+          BOOST_TEST(exp[center].get_keys() == exp_radial[center].get_keys());
+          for (const auto & key : exp[center].get_keys()) {
+            math::Matrix_t ref{exp[center][key].col(0)};
+            math::Matrix_t test{exp_radial[center][key]};
+            BOOST_TEST((ref - test).cwiseAbs().maxCoeff() < delta);
+          }
+          for (auto neigh : center.pairs_with_self_pair()) {
+            BOOST_TEST(exp_grad[neigh].get_keys() ==
+                       exp_grad_radial[neigh].get_keys());
+            for (const auto & key : exp_grad[neigh].get_keys()) {
+              math::Matrix_t ref{exp_grad[neigh][key].col(0)};
+              math::Matrix_t test{exp_grad_radial[neigh][key]};
+              BOOST_TEST((ref - test).cwiseAbs().maxCoeff() < delta);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Test that the expansions sharing the pair geometry cached in the
+   * managers match the ones computing it, and that the cache is invalidated
+   * when the structure changes
+   */
+  BOOST_FIXTURE_TEST_CASE_TEMPLATE(cache_pair_geometry_test, Fix,
+                                   contracted_basis_fixtures, Fix) {
+    using Manager_t = typename Fix::Manager_t;
+    using Representation_t = typename Fix::Representation_t;
+    using Prop_t = typename Representation_t::template Property_t<Manager_t>;
+    using PropGrad_t =
+        typename Representation_t::template PropertyGradient_t<Manager_t>;
+    using PairGeometry_t =
+        typename Representation_t::template PairGeometry_t<Manager_t>;
+
+    auto & managers = Fix::managers;
+    auto & hypers = Fix::representation_hypers;
+    const double delta{1e-14};
+
+    for (auto & manager : managers) {
+      for (auto & hyper : hypers) {
+        json hyper_cached = hyper;
+        hyper_cached["cache_pair_geometry"] = true;
+        json hyper_cached_other = hyper_cached;
+        hyper_cached_other["max_radial"] =
+            hyper.at("max_radial").template get<int>() + 1;
+
+        Representation_t expansion{hyper};
+        Representation_t expansion_cached{hyper_cached};
+        Representation_t expansion_cached_other{hyper_cached_other};
+        BOOST_TEST(expansion_cached.get_pair_cutoff_function_name() ==
+                   expansion_cached_other.get_pair_cutoff_function_name());
+        BOOST_TEST(expansion_cached.get_pair_harmonics_name() ==
+                   expansion_cached_other.get_pair_harmonics_name());
+
+        for (int i_update{0}; i_update < 2; ++i_update) {
+          if (i_update > 0) {
+            manager->send_changed_structure_signal();
+            for (auto && name :
+                 {expansion_cached.get_pair_cutoff_function_name(),
+                  expansion_cached.get_pair_harmonics_name()}) {
+              auto pair_geometry{
+                  manager->template get_property<PairGeometry_t>(name)};
+              BOOST_TEST(not pair_geometry->is_updated());
+            }
+          }
+          expansion.compute(manager);
+          expansion_cached_other.compute(manager);
+          expansion_cached.compute(manager);
+          for (auto && name :
+               {expansion_cached.get_pair_cutoff_function_name(),
+                expansion_cached.get_pair_harmonics_name()}) {
+            auto pair_geometry{
+                manager->template get_property<PairGeometry_t>(name)};
+            BOOST_TEST(pair_geometry->is_updated());
+          }
+
+          auto & exp{
+              *manager->template get_property<Prop_t>(expansion.get_name())};
+          auto & exp_cached{*manager->template get_property<Prop_t>(
+              expansion_cached.get_name())};
+          auto & exp_grad{*manager->template get_property<PropGrad_t>(
+              expansion.get_gradient_name())};
+          auto & exp_grad_cached{*manager->template get_property<PropGrad_t>(
+              expansion_cached.get_gradient_name())};
+          for (auto center : manager) {
+            for (const auto & key : exp[center].get_keys()) {
+              math::Matrix_t ref{exp[center][key]};
+              math::Matrix_t test{exp_cached[center][key]};
+              BOOST_TEST((ref - test).cwiseAbs().maxCoeff() < delta);
+            }
+            for (auto neigh : center.pairs_with_self_pair()) {
+              for (const auto & key : exp_grad[neigh].get_keys()) {
+                math::Matrix_t ref{exp_grad[neigh][key]};
+                math::Matrix_t test{exp_grad_cached[neigh][key]};
+                BOOST_TEST((ref - test).cwiseAbs().maxCoeff() < delta);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Test that the expansions computed on a neighbour list sorted by distance,
+   * which stop at the first neighbour beyond their cutoff (2 or 3 AA in the
+   * hypers) and share the spherical harmonics when cached, match the ones
+   * computed on the unsorted list
+   */
+  BOOST_FIXTURE_TEST_CASE_TEMPLATE(sorted_neighbour_list_test, Fix,
+                                   contracted_basis_fixtures, Fix) {
+    using Manager_t = typename Fix::Manager_t;
+    using ManagerTypeList_t = typename Fix::ManagerTypeList_t;
+    using Representation_t = typename Fix::Representation_t;
+    using Prop_t = typename Representation_t::template Property_t<Manager_t>;
+    using PropGrad_t =
+        typename Representation_t::template PropertyGradient_t<Manager_t>;
+    using Key_t = typename Prop_t::Key_t;
+
+    auto & managers = Fix::managers;
+    auto & hypers = Fix::representation_hypers;
+    const double delta{1e-12};
+
+    for (size_t i_manager{0}; i_manager < managers.size(); ++i_manager) {
+      auto & manager = managers[i_manager];
+      json factory_arg = Fix::factory_args[i_manager];
+      for (auto & adaptor : factory_arg.at("adaptors")) {
+        if (adaptor.at("name") == "AdaptorStrict") {
+          adaptor["initialization_arguments"]["sort_by_distance"] = true;
+        }
+      }
+      auto manager_sorted{
+          make_structure_manager_stack_with_hypers_and_typeholder<
+              ManagerTypeList_t>::apply(factory_arg["structure"],
+                                        factory_arg["adaptors"])};
+      BOOST_TEST(
+          (internal::get_sorted_by_distance(*manager_sorted) ==
+           AdaptorTraits::SortedByDistance::yes));
+
+      for (auto & hyper : hypers) {
+        json hyper_cached = hyper;
+        hyper_cached["cache_pair_geometry"] = true;
+        Representation_t expansion{hyper};
+        Representation_t expansion_cached{hyper_cached};
+        expansion.compute(manager);
+        expansion.compute(manager_sorted);
+        expansion_cached.compute(manager_sorted);
+
+        auto & exp{
+            *manager->template get_property<Prop_t>(expansion.get_name())};
+        auto & exp_grad{*manager->template get_property<PropGrad_t>(
+            expansion.get_gradient_name())};
+        for (auto * calculator : {&expansion, &expansion_cached}) {
+          auto & exp_sorted{*manager_sorted->template get_property<Prop_t>(
+              calculator->get_name())};
+          auto & exp_grad_sorted{
+              *manager_sorted->template get_property<PropGrad_t>(
+                  calculator->get_gradient_name())};
+          auto center_sorted_it = manager_sorted->begin();
+          for (auto center : manager) {
+            auto center_sorted = *center_sorted_it;
+            BOOST_TEST(center.get_atom_tag() == center_sorted.get_atom_tag());
+            BOOST_TEST(exp[center].get_keys() ==
+                       exp_sorted[center_sorted].get_keys());
+            for (const auto & key : exp[center].get_keys()) {
+              math::Matrix_t ref{exp[center][key]};
+              math::Matrix_t test{exp_sorted[center_sorted][key]};
+              BOOST_TEST((ref - test).cwiseAbs().maxCoeff() < delta);
+            }
+            // the neighbours come in a different order so the gradients are
+            // matched with the tags of the neighbours
+            std::map<std::pair<int, Key_t>, math::Matrix_t> ref_gradients{};
+            for (auto neigh : center.pairs_with_self_pair()) {
+              for (const auto & key : exp_grad[neigh].get_keys()) {
+                ref_gradients[{neigh.get_atom_tag(), key}] =
+                    exp_grad[neigh][key];
+              }
+            }
+            size_t n_gradients{0};
+            for (auto neigh : center_sorted.pairs_with_self_pair()) {
+              for (const auto & key : exp_grad_sorted[neigh].get_keys()) {
+                math::Matrix_t test{exp_grad_sorted[neigh][key]};
+                const auto & ref{
+                    ref_gradients.at({neigh.get_atom_tag(), key})};
+                BOOST_TEST((ref - test).cwiseAbs().maxCoeff() < delta);
+                ++n_gradients;
+              }
+            }
+            BOOST_TEST(n_gradients == ref_gradients.size());
+            // the centers refer to their iterator
+            ++center_sorted_it;
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Test that the expansion in a contracted radial basis (and its gradients)
+   * is the projection of the expansion in the underlying (expanded) basis
+   */
+  BOOST_FIXTURE_TEST_CASE_TEMPLATE(contracted_radial_basis_test, Fix,
+                                   contracted_basis_fixtures, Fix) {
+    using Manager_t = typename Fix::Manager_t;
+    using Representation_t = typename Fix::Representation_t;
+    using Prop_t = typename Representation_t::template Property_t<Manager_t>;
+    using PropGrad_t =
+        typename Representation_t::template PropertyGradient_t<Manager_t>;
+
+    auto & managers = Fix::managers;
+    auto & hypers = Fix::representation_hypers;
+    // the expanded radial basis of the fixture has 3 functions
+    const std::vector<std::vector<double>> projection{{1., 0.5, 0.},
+                                                      {0., -0.3, 1.}};
+    math::Matrix_t projection_matrix(2, 3);
+    projection_matrix << 1., 0.5, 0., 0., -0.3, 1.;
+    const int n_contracted{2}, n_expanded{3};
+
+    for (auto & manager : managers) {
+      for (auto & hyper : hypers) {
+        auto & optimization_hypers =
+            hyper.at("radial_contribution").at("optimization");
+        if (optimization_hypers.at("type") != "Spline") {
+          continue;
+        }
+        BOOST_REQUIRE(hyper.at("max_radial") == n_expanded);
+        // the splines of the two bases are different so their errors too
+        const double delta{
+            100 * optimization_hypers.at("accuracy").template get<double>()};
+        const size_t max_angular{
+            hyper.at("max_angular").template get<size_t>()};
+        json hyper_contracted = hyper;
+        hyper_contracted["max_radial"] = n_contracted;
+        hyper_contracted["radial_contribution"]["optimization"]
+                        ["radial_basis_projection"] = {
+                            {"expanded_max_radial", n_expanded},
+                            {"projection_matrices",
+                             std::vector<std::vector<std::vector<double>>>(
+                                 max_angular + 1, projection)}};
+
+        Representation_t expansion{hyper};
+        Representation_t expansion_contracted{hyper_contracted};
+        expansion.compute(manager);
+        expansion_contracted.compute(manager);
+        auto & exp{
+            *manager->template get_property<Prop_t>(expansion.get_name())};
+        auto & exp_contracted{*manager->template get_property<Prop_t>(
+            expansion_contracted.get_name())};
+        auto & exp_grad{*manager->template get_property<PropGrad_t>(
+            expansion.get_gradient_name())};
+        auto & exp_grad_contracted{*manager->template get_property<PropGrad_t>(
+            expansion_contracted.get_gradient_name())};
+
+        // projection of each Cartesian component of a gradient
+        math::Matrix_t projection_matrix_der{
+            math::Matrix_t::Zero(ThreeD * n_contracted, ThreeD * n_expanded)};
+        for (int cartesian_idx{0}; cartesian_idx < ThreeD; ++cartesian_idx) {
+          projection_matrix_der.block(cartesian_idx * n_contracted,
+                                      cartesian_idx * n_expanded,
+                                      n_contracted, n_expanded) =
+              projection_matrix;
+        }
+
+        for (auto center : manager) {
+          for (const auto & key : exp[center].get_keys()) {
+            math::Matrix_t ref{projection_matrix * exp[center][key]};
+            math::Matrix_t test{exp_contracted[center][key]};
+            BOOST_TEST((ref - test).cwiseAbs().maxCoeff() < delta);
+          }
+          for (auto neigh : center.pairs_with_self_pair()) {
+            for (const auto & key : exp_grad[neigh].get_keys()) {
+              math::Matrix_t ref{projection_matrix_der * exp_grad[neigh][key]};
+              math::Matrix_t test{exp_grad_contracted[neigh][key]};
+              BOOST_TEST((ref - test).cwiseAbs().maxCoeff() < delta);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Test that an expansion with a ragged angular basis l <= l_max(n) (and its
+   * gradients) matches the full expansion on the retained channels and is
+   * zero on the truncated ones
+   */
+  BOOST_FIXTURE_TEST_CASE_TEMPLATE(ragged_angular_basis_test, Fix,
+                                   contracted_basis_fixtures, Fix) {
+    using Manager_t = typename Fix::Manager_t;
+    using Representation_t = typename Fix::Representation_t;
+    using Prop_t = typename Representation_t::template Property_t<Manager_t>;
+    using PropGrad_t =
+        typename Representation_t::template PropertyGradient_t<Manager_t>;
+
+    auto & managers = Fix::managers;
+    auto & hypers = Fix::representation_hypers;
+    const double delta{1e-10};
+
+    for (auto & manager : managers) {
+      for (auto & hyper : hypers) {
+        const size_t max_radial{hyper.at("max_radial").template get<size_t>()};
+        const size_t max_angular{
+            hyper.at("max_angular").template get<size_t>()};
+        std::vector<size_t> max_angular_per_radial{};
+        for (size_t n{0}; n < max_radial; ++n) {
+          max_angular_per_radial.push_back(max_angular -
+                                           std::min(n, max_angular));
+        }
+        json hyper_ragged = hyper;
+        hyper_ragged["max_angular_per_radial"] = max_angular_per_radial;
+
+        Representation_t expansion{hyper};
+        Representation_t expansion_ragged{hyper_ragged};
+        expansion.compute(manager);
+        expansion_ragged.compute(manager);
+        auto & exp{
+            *manager->template get_property<Prop_t>(expansion.get_name())};
+        auto & exp_ragged{*manager->template get_property<Prop_t>(
+            expansion_ragged.get_name())};
+        auto & exp_grad{*manager->template get_property<PropGrad_t>(
+            expansion.get_gradient_name())};
+        auto & exp_grad_ragged{*manager->template get_property<PropGrad_t>(
+            expansion_ragged.get_gradient_name())};
+
+        // truncate the full expansion to the ragged basis
+        auto truncate = [&](const math::Matrix_t & coefficients, int n_dims) {
+          math::Matrix_t truncated{coefficients};
+          for (int i_dim{0}; i_dim < n_dims; ++i_dim) {
+            for (size_t n{0}; n < max_radial; ++n) {
+              const size_t l_max{max_angular_per_radial[n]};
+              const int n_cols{static_cast<int>(
+                  (max_angular + 1) * (max_angular + 1) -
+                  (l_max + 1) * (l_max + 1))};
+              truncated
+                  .block(i_dim * max_radial + n, (l_max + 1) * (l_max + 1), 1,
+                         n_cols)
+                  .setZero();
+            }
+          }
+          return truncated;
+        };
+
+        for (auto center : manager) {
+          for (const auto & key : exp[center].get_keys()) {
+            math::Matrix_t ref{truncate(exp[center][key], 1)};
+            math::Matrix_t test{exp_ragged[center][key]};
+            BOOST_TEST((ref - test).cwiseAbs().maxCoeff() < delta);
+          }
+          for (auto neigh : center.pairs_with_self_pair()) {
+            for (const auto & key : exp_grad[neigh].get_keys()) {
+              math::Matrix_t ref{truncate(exp_grad[neigh][key], ThreeD)};
+              math::Matrix_t test{exp_grad_ragged[neigh][key]};
+              BOOST_TEST((ref - test).cwiseAbs().maxCoeff() < delta);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Test that the power spectrum of a ragged angular basis only differs from
+   * the full one by the p_{n_1 n_2 l} with l > min(l_max(n_1), l_max(n_2)),
+   * which are zero
+   */
+  BOOST_FIXTURE_TEST_CASE_TEMPLATE(ragged_angular_basis_powerspectrum_test,
+                                   Fix, grad_sparse_fixtures, Fix) {
+    using Manager_t = typename Fix::Manager_t;
+    using Representation_t = typename Fix::Representation_t;
+    using Prop_t = typename Representation_t::template Property_t<Manager_t>;
+
+    auto & managers = Fix::managers;
+    auto & hypers = Fix::representation_hypers;
+    const double delta{1e-10};
+
+    for (auto & manager : managers) {
+      for (auto & hyper : hypers) {
+        const size_t max_radial{hyper.at("max_radial").template get<size_t>()};
+        const size_t max_angular{
+            hyper.at("max_angular").template get<size_t>()};
+        std::vector<size_t> max_angular_per_radial{};
+        for (size_t n{0}; n < max_radial; ++n) {
+          max_angular_per_radial.push_back(max_angular -
+                                           std::min(n, max_angular));
+        }
+        json hyper_full = hyper;
+        hyper_full["normalize"] = false;
+        hyper_full["compute_gradients"] = false;
+        json hyper_ragged = hyper_full;
+        hyper_ragged["max_angular_per_radial"] = max_angular_per_radial;
+
+        Representation_t soap{hyper_full};
+        Representation_t soap_ragged{hyper_ragged};
+        soap.compute(manager);
+        soap_ragged.compute(manager);
+        auto & ps{*manager->template get_property<Prop_t>(soap.get_name())};
+        auto & ps_ragged{
+            *manager->template get_property<Prop_t>(soap_ragged.get_name())};
+
+        for (auto center : manager) {
+          for (const auto & key : ps[center].get_keys()) {
+            math::Matrix_t ref{ps[center][key]};
+            for (size_t n1{0}; n1 < max_radial; ++n1) {
+              for (size_t n2{0}; n2 < max_radial; ++n2) {
+                const size_t l_max{std::min(max_angular_per_radial[n1],
+                                            max_angular_per_radial[n2])};
+                ref.block(n1 * max_radial + n2, l_max + 1, 1,
+                          max_angular - l_max)
+                    .setZero();
+              }
+            }
+            math::Matrix_t test{ps_ragged[center][key]};
+            BOOST_TEST((ref - test).cwiseAbs().maxCoeff() < delta);
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Test that the power_spectrum_projection gives the projections of the
+   * full powerspectrum and of its gradients
+   */
+  BOOST_FIXTURE_TEST_CASE_TEMPLATE(power_spectrum_projection_test, Fix,
+                                   grad_sparse_fixtures, Fix) {
+    using Manager_t = typename Fix::Manager_t;
+    using Representation_t = typename Fix::Representation_t;
+    using Prop_t = typename Representation_t::template Property_t<Manager_t>;
+    using PropGrad_t =
+        typename Representation_t::template PropertyGradient_t<Manager_t>;
+    using Key_t = typename Prop_t::Key_t;
+
+    auto & managers = Fix::managers;
+    auto & hypers = Fix::representation_hypers;
+    const double delta{1e-10};
+    const size_t n_projected{4};
+
+    for (auto & manager : managers) {
+      for (auto & hyper : hypers) {
+        const size_t max_radial{hyper.at("max_radial").template get<size_t>()};
+        const size_t max_angular{
+            hyper.at("max_angular").template get<size_t>()};
+        const size_t n_features{max_radial * max_radial * (max_angular + 1)};
+        json hyper_full = hyper;
+        hyper_full["normalize"] = false;
+        hyper_full["compute_gradients"] = true;
+        Representation_t soap{hyper_full};
+        soap.compute(manager);
+        auto & ps{*manager->template get_property<Prop_t>(soap.get_name())};
+        auto & ps_grad{*manager->template get_property<PropGrad_t>(
+            soap.get_gradient_name())};
+
+        std::map<Key_t, math::Matrix_t> projections{};
+        for (auto center : manager) {
+          for (const auto & key : ps[center].get_keys()) {
+            if (projections.count(key) == 0) {
+              projections[key] =
+                  math::Matrix_t::Random(n_projected, n_features);
+            }
+          }
+        }
+        json species_pairs = json::array();
+        json projection_matrices = json::array();
+        for (const auto & projection : projections) {
+          species_pairs.push_back(projection.first);
+          json matrix = json::array();
+          for (size_t i_row{0}; i_row < n_projected; ++i_row) {
+            std::vector<double> row(n_features);
+            for (size_t i_col{0}; i_col < n_features; ++i_col) {
+              row[i_col] = projection.second(i_row, i_col);
+            }
+            matrix.push_back(row);
+          }
+          projection_matrices.push_back(matrix);
+        }
+        json hyper_projected = hyper_full;
+        hyper_projected["power_spectrum_projection"] = {
+            {"species_pairs", species_pairs},
+            {"projection_matrices", projection_matrices}};
+        Representation_t soap_projected{hyper_projected};
+        soap_projected.compute(manager);
+        auto & ps_projected{*manager->template get_property<Prop_t>(
+            soap_projected.get_name())};
+        auto & ps_grad_projected{*manager->template get_property<PropGrad_t>(
+            soap_projected.get_gradient_name())};
+
+        for (auto center : manager) {
+          BOOST_TEST(ps[center].get_keys() == ps_projected[center].get_keys());
+          for (const auto & key : ps[center].get_keys()) {
+            math::Matrix_t full{ps[center][key]};
+            Eigen::VectorXd ref{projections[key] *
+                                Eigen::Map<Eigen::VectorXd>(full.data(),
+                                                            full.size())};
+            math::Matrix_t test{ps_projected[center][key]};
+            BOOST_TEST(test.size() == n_projected);
+            BOOST_TEST((ref - Eigen::Map<Eigen::VectorXd>(test.data(),
+                                                          test.size()))
+                           .cwiseAbs()
+                           .maxCoeff() < delta);
+          }
+          for (auto neigh : center.pairs_with_self_pair()) {
+            auto keys = ps_grad[neigh].get_keys();
+            BOOST_TEST(keys == ps_grad_projected[neigh].get_keys());
+            for (const auto & key : keys) {
+              math::Matrix_t full{ps_grad[neigh][key]};
+              math::Matrix_t test{ps_grad_projected[neigh][key]};
+              for (int i_der{0}; i_der < ThreeD; ++i_der) {
+                Eigen::VectorXd ref{
+                    projections[key] *
+                    Eigen::Map<Eigen::VectorXd>(
+                        full.data() + i_der * n_features, n_features)};
+                BOOST_TEST(
+                    (ref - Eigen::Map<Eigen::VectorXd>(
+                               test.data() + i_der * n_projected, n_projected))
+                        .cwiseAbs()
+                        .maxCoeff() < delta);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Test that the compile time sized power spectrum contractions match the
+   * generic ones
+   */
+  BOOST_AUTO_TEST_CASE(powerspectrum_kernel_test) {
+    constexpr int max_radial{6}, max_angular{4};
+    const size_t n_coefs{(max_angular + 1) * (max_angular + 1)};
+    const size_t n_features{max_radial * max_radial * (max_angular + 1)};
+    const double delta{1e-12};
+    const double factor{math::SQRT_TWO};
+    const Eigen::VectorXd l_factors{
+        internal::precompute_l_factors(max_angular)};
+    const math::Matrix_t coef1{math::Matrix_t::Random(max_radial, n_coefs)};
+    const math::Matrix_t coef2{math::Matrix_t::Random(max_radial, n_coefs)};
+    const math::Matrix_t grad_coef1{
+        math::Matrix_t::Random(ThreeD * max_radial, n_coefs)};
+
+    internal::PowerSpectrumKernel<max_radial, max_angular> kernel{
+        max_radial, max_angular};
+    internal::PowerSpectrumKernel<Eigen::Dynamic, Eigen::Dynamic>
+        kernel_dynamic{max_radial, max_angular};
+
+    Eigen::VectorXd ref(n_features), test(n_features);
+    kernel_dynamic.compute(coef1, coef2, l_factors, factor, ref.data());
+    kernel.compute(coef1, coef2, l_factors, factor, test.data());
+    BOOST_TEST((ref - test).cwiseAbs().maxCoeff() < delta);
+
+    for (const auto & add_direct : {true, false}) {
+      for (const auto & add_swapped : {true, false}) {
+        Eigen::VectorXd ref_gradient{
+            Eigen::VectorXd::Ones(ThreeD * n_features)};
+        Eigen::VectorXd test_gradient{ref_gradient};
+        kernel_dynamic.add_gradient(grad_coef1, coef2, l_factors, factor,
+                                    add_direct, add_swapped,
+                                    ref_gradient.data());
+        kernel.add_gradient(grad_coef1, coef2, l_factors, factor, add_direct,
+                            add_swapped, test_gradient.data());
+        BOOST_TEST((ref_gradient - test_gradient).cwiseAbs().maxCoeff() <
+                   delta);
+      }
+    }
+  }
+
   using gradient_fixtures = boost::mpl::list<
       CalculatorFixture<
           SingleHypersSphericalExpansion<SimplePeriodicNLCCStrictFixture>>,
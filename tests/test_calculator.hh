@@ -34,6 +34,7 @@
 #include "test_structure.hh"
 
 #include "rascal/representations/calculator_base.hh"
+#include "rascal/representations/calculator_instantiations.hh"
 #include "rascal/representations/calculator_sorted_coulomb.hh"
 #include "rascal/representations/calculator_spherical_covariants.hh"
 #include "rascal/representations/calculator_spherical_expansion.hh"
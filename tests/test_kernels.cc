@@ -189,6 +189,103 @@ namespace rascal {
     }
   }
 
+  /**
+   * Tests that gathering the representation in the arena of the collection
+   * gives the same features and kernels, and that the properties leave the
+   * arena once they are recomputed.
+   */
+  BOOST_FIXTURE_TEST_CASE_TEMPLATE(arena_kernel_test, Fix, multiple_fixtures,
+                                   Fix) {
+    using Property_t = typename Fix::Property_t;
+    auto & kernels = Fix::kernels;
+    auto & representations = Fix::representations;
+    auto & collections = Fix::collections;
+
+    for (auto & collection : collections) {
+      for (auto & representation : representations) {
+        const auto name{representation.get_name()};
+        math::Matrix_t features_ref = collection.get_features(representation);
+        std::vector<math::Matrix_t> kernels_ref{}, kernels_sym_ref{};
+        for (auto & kernel : kernels) {
+          kernels_ref.push_back(
+              kernel.compute(representation, collection, collection));
+          kernels_sym_ref.push_back(kernel.compute(representation, collection));
+        }
+
+        BOOST_CHECK(not collection.template has_arena<Property_t>(name));
+        collection.make_arena(representation);
+        BOOST_CHECK(collection.template has_arena<Property_t>(name));
+
+        auto features = collection.get_features_view(representation);
+        BOOST_CHECK_EQUAL(features.rows(), features_ref.rows());
+        BOOST_CHECK_EQUAL(features.cols(), features_ref.cols());
+        BOOST_CHECK_EQUAL((features - features_ref).norm(), 0.);
+
+        // the properties are views of the rows of the arena
+        int i_row{0};
+        for (auto & manager : collection) {
+          auto && property{
+              *manager->template get_property<Property_t>(name, true)};
+          auto raw_data = property.get_raw_data_view();
+          BOOST_CHECK_EQUAL(raw_data.data(), features.data() +
+                                                 i_row * features.cols());
+          i_row += property.size();
+        }
+
+        for (size_t i_kernel{0}; i_kernel < kernels.size(); ++i_kernel) {
+          auto & kernel = kernels[i_kernel];
+          auto mat = kernel.compute(representation, collection, collection);
+          auto diff = math::relative_error(mat, kernels_ref[i_kernel]);
+          BOOST_CHECK_LE(diff.maxCoeff(), 1e-12);
+          mat = kernel.compute(representation, collection);
+          diff = math::relative_error(mat, kernels_sym_ref[i_kernel]);
+          BOOST_CHECK_LE(diff.maxCoeff(), 1e-12);
+        }
+
+        // recomputing a property takes it out of the arena
+        collection[0]->template get_property<Property_t>(name)
+            ->set_updated_status(false);
+        representation.compute(collection);
+        BOOST_CHECK(not collection.template has_arena<Property_t>(name));
+        BOOST_CHECK_THROW(collection.get_features_view(representation),
+                          std::runtime_error);
+        features_ref -= collection.get_features(representation);
+        BOOST_CHECK_LE(features_ref.norm(), 1e-12);
+      }
+    }
+  }
+
+  /**
+   * Tests that filling a user provided buffer, serially or with several
+   * threads, gives the features of get_features.
+   */
+  BOOST_FIXTURE_TEST_CASE_TEMPLATE(fill_features_test, Fix, multiple_fixtures,
+                                   Fix) {
+    auto & representations = Fix::representations;
+    auto & collections = Fix::collections;
+
+    for (auto & collection : collections) {
+      for (auto & representation : representations) {
+        math::Matrix_t features_ref = collection.get_features(representation);
+        auto shape = collection.get_features_shape(representation);
+        BOOST_CHECK_EQUAL(shape[0], features_ref.rows());
+        BOOST_CHECK_EQUAL(shape[1], features_ref.cols());
+
+        for (size_t n_threads : {1, 3, 64}) {
+          math::Matrix_t features =
+              math::Matrix_t::Constant(shape[0], shape[1], 1.);
+          collection.fill_features(representation, features, n_threads);
+          BOOST_CHECK_EQUAL((features - features_ref).norm(), 0.);
+        }
+
+        math::Matrix_t wrong_shape(shape[0] + 1, shape[1]);
+        BOOST_CHECK_THROW(
+            collection.fill_features(representation, wrong_shape, 2),
+            std::runtime_error);
+      }
+    }
+  }
+
   BOOST_AUTO_TEST_SUITE_END();
 
 }  // namespace rascal
@@ -30,6 +30,7 @@
 #define TESTS_TEST_MATH_HH_
 
 #include "rascal/math/bessel.hh"
+#include "rascal/math/clebsch_gordan.hh"
 #include "rascal/math/gauss_legendre.hh"
 #include "rascal/math/hyp1f1.hh"
 #include "rascal/math/spherical_harmonics.hh"
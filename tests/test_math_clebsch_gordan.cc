@@ -0,0 +1,241 @@
+/**
+ * @file   test_math_clebsch_gordan.cc
+ *
+ * @author  Felix Musil <felix.musil@epfl.ch>
+ *
+ * @date   18 October 2026
+ *
+ * @brief Test the sparse Clebsch-Gordan couplings against a direct
+ *        evaluation with complex coefficients
+ *
+ * Copyright © 2026  Felix Musil, COSMO (EPFL), LAMMM (EPFL)
+ *
+ * rascal is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3, or (at
+ * your option) any later version.
+ *
+ * rascal is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GNU Emacs; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#include "test_math.hh"
+
+#include <boost/test/unit_test.hpp>
+
+#include <wigxjpf.h>
+
+#include <complex>
+
+namespace rascal {
+
+  BOOST_AUTO_TEST_SUITE(MathClebschGordanTests);
+
+  using complex = std::complex<double>;
+
+  //! complex coefficient from the real ones (see spherical_harmonics.hh)
+  complex get_complex_coefficient(const math::Matrix_t & coefficients, int n,
+                                  int l, int m) {
+    const int lm{l * l + l + m};
+    if (m > 0) {
+      return math::pow(-1., m) *
+             complex{coefficients(n, lm), coefficients(n, lm - 2 * m)} *
+             math::INV_SQRT_TWO;
+    } else if (m == 0) {
+      return complex{coefficients(n, lm), 0.};
+    } else {
+      return complex{coefficients(n, lm - 2 * m), -coefficients(n, lm)} *
+             math::INV_SQRT_TWO;
+    }
+  }
+
+  //! bispectrum computed directly with Wigner 3j symbols
+  math::Matrix_t get_bispectrum_reference(const math::Matrix_t & coefs1,
+                                          const math::Matrix_t & coefs2,
+                                          const math::Matrix_t & coefs3,
+                                          int max_angular,
+                                          bool inversion_symmetry) {
+    std::vector<std::vector<double>> outputs{};
+    for (int l1{0}; l1 < max_angular + 1; ++l1) {
+      for (int l2{0}; l2 < max_angular + 1; ++l2) {
+        for (int l3{0}; l3 < max_angular + 1; ++l3) {
+          if (l1 < std::abs(l2 - l3) or l1 > l2 + l3 or
+              (inversion_symmetry and (l1 + l2 + l3) % 2 == 1)) {
+            continue;
+          }
+          std::vector<double> output{};
+          for (int n1{0}; n1 < coefs1.rows(); ++n1) {
+            for (int n2{0}; n2 < coefs2.rows(); ++n2) {
+              for (int n3{0}; n3 < coefs3.rows(); ++n3) {
+                complex value{0., 0.};
+                for (int m1{-l1}; m1 < l1 + 1; ++m1) {
+                  for (int m2{-l2}; m2 < l2 + 1; ++m2) {
+                    const int m3{-m1 - m2};
+                    if (std::abs(m3) > l3) {
+                      continue;
+                    }
+                    value += wig3jj(2 * l1, 2 * l2, 2 * l3, 2 * m1, 2 * m2,
+                                    2 * m3) *
+                             get_complex_coefficient(coefs1, n1, l1, m1) *
+                             get_complex_coefficient(coefs2, n2, l2, m2) *
+                             get_complex_coefficient(coefs3, n3, l3, m3);
+                  }
+                }
+                output.push_back((l1 + l2 + l3) % 2 == 0 ? value.real()
+                                                         : value.imag());
+              }
+            }
+          }
+          outputs.push_back(output);
+        }
+      }
+    }
+    math::Matrix_t result(outputs.size(), outputs.front().size());
+    for (size_t i_out{0}; i_out < outputs.size(); ++i_out) {
+      for (size_t i_n{0}; i_n < outputs[i_out].size(); ++i_n) {
+        result(i_out, i_n) = outputs[i_out][i_n];
+      }
+    }
+    return result;
+  }
+
+  /* ---------------------------------------------------------------------- */
+  /**
+   * Check the sparse bispectrum couplings against the direct evaluation
+   */
+  BOOST_AUTO_TEST_CASE(bispectrum_couplings_test) {
+    const double delta{1e-12};
+    for (int max_angular : {0, 1, 3}) {
+      const int n_lm{(max_angular + 1) * (max_angular + 1)};
+      math::Matrix_t coefs1{math::Matrix_t::Random(2, n_lm)};
+      math::Matrix_t coefs2{math::Matrix_t::Random(3, n_lm)};
+      math::Matrix_t coefs3{math::Matrix_t::Random(2, n_lm)};
+      for (bool inversion_symmetry : {true, false}) {
+        math::SparseClebschGordan couplings{};
+        couplings.precompute_bispectrum(max_angular, inversion_symmetry);
+        BOOST_CHECK_EQUAL(couplings.get_order(), 3);
+
+        wig_table_init(2 * (max_angular + 1), 3);
+        wig_temp_init(2 * (max_angular + 1));
+        math::Matrix_t reference{get_bispectrum_reference(
+            coefs1, coefs2, coefs3, max_angular, inversion_symmetry)};
+        wig_temp_free();
+        wig_table_free();
+
+        math::Matrix_t result(couplings.get_n_outputs(), 2 * 3 * 2);
+        BOOST_REQUIRE_EQUAL(result.rows(), reference.rows());
+        couplings.contract(coefs1.transpose(), coefs2.transpose(),
+                           coefs3.transpose(), result);
+        BOOST_CHECK_LE((result - reference).cwiseAbs().maxCoeff(), delta);
+      }
+    }
+  }
+
+  /**
+   * Check the sparse lambda-spectrum couplings against the direct
+   * evaluation of the covariant combination of Wigner 3j symbols as
+   * implemented in CalculatorSphericalCovariants
+   */
+  BOOST_AUTO_TEST_CASE(lambda_spectrum_couplings_test) {
+    const double delta{1e-12};
+    const int max_angular{3};
+    const int n_lm{(max_angular + 1) * (max_angular + 1)};
+    math::Matrix_t coefs1{math::Matrix_t::Random(2, n_lm)};
+    math::Matrix_t coefs2{math::Matrix_t::Random(3, n_lm)};
+    for (int lambda : {0, 1, 2, 4}) {
+      for (bool inversion_symmetry : {true, false}) {
+        math::SparseClebschGordan couplings{};
+        couplings.precompute_lambda_spectrum(max_angular, lambda,
+                                             inversion_symmetry);
+        BOOST_CHECK_EQUAL(couplings.get_order(), 2);
+
+        wig_table_init(2 * (max_angular + lambda + 1), 3);
+        wig_temp_init(2 * (max_angular + lambda + 1));
+        std::vector<std::vector<double>> outputs{};
+        const int l3{lambda};
+        for (int l1{0}; l1 < max_angular + 1; ++l1) {
+          for (int l2{0}; l2 < max_angular + 1; ++l2) {
+            if (l1 < std::abs(l2 - l3) or l1 > l2 + l3 or
+                (inversion_symmetry and (l1 + l2 + l3) % 2 == 1)) {
+              continue;
+            }
+            // same enumeration of the symbols as the reference
+            // implementation of CalculatorSphericalCovariants
+            std::vector<double> w3js{};
+            for (int m1{-l1}; m1 < l1 + 1; ++m1) {
+              for (int m2{-l2}; m2 < l2 + 1; ++m2) {
+                for (int m3{-l3}; m3 < l3 + 1; ++m3) {
+                  if ((m1 + m2 + m3 != 0) and (m1 + m2 - m3 != 0)) {
+                    continue;
+                  }
+                  double w3j1{
+                      wig3jj(2 * l1, 2 * l2, 2 * l3, 2 * m1, 2 * m2, 2 * m3)};
+                  double w3j2{wig3jj(2 * l1, 2 * l2, 2 * l3, 2 * m1, 2 * m2,
+                                     -2 * m3)};
+                  if (m3 > 0) {
+                    w3js.push_back((w3j2 + math::pow(-1., m3) * w3j1) *
+                                   math::INV_SQRT_TWO);
+                  } else if (m3 < 0) {
+                    w3js.push_back((w3j1 - math::pow(-1., m3) * w3j2) *
+                                   math::INV_SQRT_TWO);
+                  } else {
+                    w3js.push_back(w3j1);
+                  }
+                }
+              }
+            }
+            for (int m3{-l3}; m3 < l3 + 1; ++m3) {
+              outputs.emplace_back();
+            }
+            for (int n1{0}; n1 < coefs1.rows(); ++n1) {
+              for (int n2{0}; n2 < coefs2.rows(); ++n2) {
+                size_t i_w3j{0};
+                for (int m3{-l3}; m3 < l3 + 1; ++m3) {
+                  complex value{0., 0.};
+                  for (int m1{-l1}; m1 < l1 + 1; ++m1) {
+                    for (int m2{-l2}; m2 < l2 + 1; ++m2) {
+                      if ((m1 + m2 + m3 != 0) and (m1 + m2 - m3 != 0)) {
+                        continue;
+                      }
+                      value += w3js[i_w3j++] *
+                               get_complex_coefficient(coefs1, n1, l1, m1) *
+                               get_complex_coefficient(coefs2, n2, l2, m2);
+                    }
+                  }
+                  if (m3 < 0) {
+                    value *= complex{0., 1.};
+                  }
+                  outputs[outputs.size() - 2 * l3 - 1 + m3 + l3].push_back(
+                      (l1 + l2 + l3) % 2 == 0 ? value.real() : value.imag());
+                }
+              }
+            }
+          }
+        }
+        wig_temp_free();
+        wig_table_free();
+
+        BOOST_REQUIRE_EQUAL(couplings.get_n_outputs(), outputs.size());
+        math::Matrix_t result(couplings.get_n_outputs(), 2 * 3);
+        couplings.contract(coefs1.transpose(), coefs2.transpose(), result);
+        for (size_t i_out{0}; i_out < outputs.size(); ++i_out) {
+          for (size_t i_n{0}; i_n < outputs[i_out].size(); ++i_n) {
+            BOOST_CHECK_SMALL(result(i_out, i_n) - outputs[i_out][i_n],
+                              delta);
+          }
+        }
+      }
+    }
+  }
+
+  /* ---------------------------------------------------------------------- */
+  BOOST_AUTO_TEST_SUITE_END();
+
+}  // namespace rascal
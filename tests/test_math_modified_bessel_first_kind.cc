@@ -107,6 +107,38 @@ namespace rascal {
     }
   }
 
+  /**
+   * Check that the batched evaluation over several distances matches the
+   * evaluation one distance at a time, covering both the upward and
+   * downward recursion regimes
+   */
+  BOOST_AUTO_TEST_CASE(MBFs_batch_test) {
+    std::vector<size_t> max_angulars{{0, 1, 6, 20}};
+    std::vector<double> alphas{{0.6, 3.5, 20, 50}};
+    Eigen::ArrayXd xs = Eigen::ArrayXd::LinSpaced(12, 0.005, 6);
+    Eigen::ArrayXd distances = Eigen::ArrayXd::LinSpaced(15, 0.05, 6);
+
+    for (const auto & max_angular : max_angulars) {
+      for (const auto & alpha : alphas) {
+        math::ModifiedSphericalBessel single{}, batch{};
+        single.precompute(max_angular, xs.matrix(), true);
+        batch.precompute(max_angular, xs.matrix(), true);
+        batch.calc(distances, alpha);
+        for (int i_dist{0}; i_dist < distances.size(); ++i_dist) {
+          single.calc(distances[i_dist], alpha);
+          Eigen::MatrixXd vals = single.get_values().matrix();
+          Eigen::MatrixXd batch_vals = batch.get_values(i_dist).matrix();
+          Eigen::MatrixXd grads = single.get_gradients().matrix();
+          Eigen::MatrixXd batch_grads = batch.get_gradients(i_dist).matrix();
+          auto vals_error{math::relative_error(vals, batch_vals, 1e-12)};
+          auto grads_error{math::relative_error(grads, batch_grads, 1e-12)};
+          BOOST_CHECK_LE(vals_error.maxCoeff(), 1e-12);
+          BOOST_CHECK_LE(grads_error.maxCoeff(), 1e-12);
+        }
+      }
+    }
+  }
+
   /* ----------------------------------------------------------------------
    */
   BOOST_AUTO_TEST_SUITE_END();
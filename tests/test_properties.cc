@@ -210,6 +210,10 @@ namespace rascal {
       // BOOST_CHECK_EQUAL(Fix::atom_scalar_property[atom], eigen_counter);
       counter++;
     }
+    // the raw data view is the feature matrix without the copy
+    auto features = Fix::atom_vector_property.get_features();
+    auto features_view = Fix::atom_vector_property.get_raw_data_view();
+    BOOST_CHECK_EQUAL((features_view - features).norm(), 0.);
 
     if (verbose) {
       std::cout << ">> Test for manager ";
@@ -908,6 +912,176 @@ namespace rascal {
     }
   }
 
+  /* ---------------------------------------------------------------------- */
+  /**
+   * test that the entries with the same keys share their layout and that
+   * the blocks of each entry are still distinct
+   */
+  BOOST_FIXTURE_TEST_CASE(shared_layout_test, BlockSparsePropertyFixture<1>) {
+    // the elements of the keys are sorted so {8, 1} and {1, 8} are the same
+    std::vector<std::set<Key_t>> key_sets{
+        {{1, 8}, {8, 8}}, {{8, 1}, {8, 8}}, {{1}}, {}};
+    for (size_t i_manager{0}; i_manager < managers.size(); ++i_manager) {
+      auto & manager = managers[i_manager];
+      auto & sparse_feature = sparse_features[i_manager];
+      std::vector<std::set<Key_t>> keys{};
+      for (size_t i_center{0}; i_center < manager->get_size(); ++i_center) {
+        keys.push_back(key_sets[i_center % key_sets.size()]);
+      }
+      sparse_feature.set_shape(n_row, n_col);
+      sparse_feature.resize(keys);
+      // no keys (always present), {1, 8} and {8, 8}, {1}
+      BOOST_CHECK_EQUAL(sparse_feature.get_nb_layouts(),
+                        keys.size() > 2 ? 3 : 2);
+      BOOST_CHECK_EQUAL(sparse_feature.are_keys_uniform(), keys.size() == 1);
+
+      int i_center{0};
+      for (auto center : manager) {
+        auto && entry{sparse_feature[center]};
+        for (auto el : entry) {
+          el.second.setConstant(i_center);
+        }
+        ++i_center;
+      }
+      i_center = 0;
+      for (auto center : manager) {
+        auto && entry{sparse_feature[center]};
+        const auto & key_set{keys[i_center]};
+        BOOST_CHECK_EQUAL(entry.get_keys().size(), key_set.size());
+        BOOST_CHECK_EQUAL(entry.size(), key_set.size() * n_row * n_col);
+        for (const auto & key : key_set) {
+          BOOST_CHECK_EQUAL(entry.count(key), 1);
+          BOOST_CHECK_EQUAL(entry[key](n_row - 1, n_col - 1), i_center);
+        }
+        BOOST_CHECK_EQUAL(entry.count(Key_t{2}), 0);
+        BOOST_CHECK_THROW(entry.at(Key_t{2}), std::out_of_range);
+        ++i_center;
+      }
+    }
+  }
+
+  /* ---------------------------------------------------------------------- */
+  /**
+   * test that the blocks can be found in the storage view with the entry
+   * offsets and the layouts, which is how they are read without copy from
+   * python
+   */
+  BOOST_FIXTURE_TEST_CASE(storage_view_test, BlockSparsePropertyFixture<1>) {
+    for (size_t i_manager{0}; i_manager < managers.size(); ++i_manager) {
+      auto & manager = managers[i_manager];
+      auto & keys = keys_list[i_manager];
+      auto & sparse_feature = sparse_features[i_manager];
+      sparse_feature.set_shape(n_row, n_col);
+      sparse_feature.resize(keys);
+      int i_center{0};
+      for (auto center : manager) {
+        for (auto & key : keys[i_center]) {
+          sparse_feature[center][key] = test_datas[i_manager][i_center][key];
+        }
+        ++i_center;
+      }
+
+      auto storage = sparse_feature.get_storage_view();
+      auto offsets = sparse_feature.get_entry_offsets();
+      auto layout_ids = sparse_feature.get_entry_layout_ids();
+      const auto & layouts = sparse_feature.get_layouts();
+      BOOST_REQUIRE_EQUAL(offsets.size(), manager->size());
+      BOOST_REQUIRE_EQUAL(layout_ids.size(), manager->size());
+      for (size_t i_entry{0}; i_entry < offsets.size(); ++i_entry) {
+        const auto & layout = layouts.at(layout_ids[i_entry]);
+        BOOST_CHECK_EQUAL(layout.offsets.size(), keys[i_entry].size());
+        BOOST_CHECK_LE(offsets[i_entry] + layout.total_length,
+                       static_cast<size_t>(storage.size()));
+        for (auto & key : keys[i_entry]) {
+          Eigen::Map<const Matrix_t> block(
+              storage.data() + offsets[i_entry] + layout.offsets.at(key),
+              layout.n_row, layout.n_col);
+          BOOST_CHECK_EQUAL(
+              (block - test_datas[i_manager][i_entry][key]).norm(), 0.);
+        }
+      }
+    }
+  }
+
+  /* ---------------------------------------------------------------------- */
+  /**
+   * test that the entries stored in a memory mapped file hold the same data
+   * as the ones in memory, also after resizing the property
+   */
+  BOOST_FIXTURE_TEST_CASE(backing_file_test, BlockSparsePropertyFixture<1>) {
+    for (size_t i_manager{0}; i_manager < managers.size(); ++i_manager) {
+      auto & manager = managers[i_manager];
+      auto & keys = keys_list[i_manager];
+      auto & sparse_feature = sparse_features[i_manager];
+      BlockSparseProperty_t mapped_feature{*manager, sparse_features_desc,
+                                           exclude_ghosts};
+      mapped_feature.set_backing_directory(".");
+      // the second resize gives the file its final size
+      for (auto & keys_ : {std::vector<std::set<Key_t>>(keys.size()), keys}) {
+        for (auto * property : {&sparse_feature, &mapped_feature}) {
+          property->set_shape(n_row, n_col);
+          property->resize(keys_);
+          property->setZero();
+          int i_center{0};
+          for (auto center : manager) {
+            for (auto & key : keys_[i_center]) {
+              (*property)[center][key] = test_datas[i_manager][i_center][key];
+            }
+            ++i_center;
+          }
+        }
+      }
+      BOOST_REQUIRE(mapped_feature.get_backing_file() != nullptr);
+      BOOST_CHECK(sparse_feature.get_backing_file() == nullptr);
+
+      size_t n_values{0};
+      for (auto center : manager) {
+        n_values += mapped_feature[center].size();
+      }
+      BOOST_CHECK_EQUAL(mapped_feature.get_backing_file()->size(),
+                        n_values * sizeof(double));
+
+      auto features_ref = sparse_feature.get_features();
+      auto features = mapped_feature.get_features();
+      BOOST_CHECK_EQUAL((features - features_ref).norm(), 0.);
+      BOOST_CHECK_EQUAL(mapped_feature.sum(), sparse_feature.sum());
+
+      // going back to memory keeps working
+      mapped_feature.set_backing_directory("");
+      mapped_feature.resize(keys);
+      BOOST_CHECK(mapped_feature.get_backing_file() == nullptr);
+    }
+    BOOST_CHECK_THROW(MappedFile("/this/directory/does/not/exist"),
+                      std::runtime_error);
+  }
+
+  /* ---------------------------------------------------------------------- */
+  /**
+   * test that the key index of the block sparse entries stays sorted and
+   * unique whatever the insertion order
+   */
+  BOOST_AUTO_TEST_CASE(sorted_vector_map_test) {
+    using Key_t = std::vector<int>;
+    internal::SortedVectorMap<Key_t, int> map{};
+    std::vector<Key_t> keys{{8, 1}, {1, 6}, {8}, {1, 1}, {6, 8}};
+    int i_key{0};
+    for (const auto & key : keys) {
+      map[key] = i_key;
+      ++i_key;
+    }
+    // inserting an existing key does not duplicate it
+    map[keys[2]] = 10;
+    BOOST_CHECK_EQUAL(map.size(), keys.size());
+    BOOST_CHECK(std::is_sorted(
+        map.begin(), map.end(),
+        [](const auto & a, const auto & b) { return a.first < b.first; }));
+    BOOST_CHECK_EQUAL(map.at(keys[2]), 10);
+    BOOST_CHECK_EQUAL(map.at(keys[4]), 4);
+    BOOST_CHECK_EQUAL(map.count(Key_t{8, 2}), 0);
+    BOOST_CHECK_EQUAL(map.count(keys[0]), 1);
+    BOOST_CHECK_THROW(map.at(Key_t{2}), std::out_of_range);
+  }
+
   BOOST_AUTO_TEST_SUITE_END();
 
   /* ---------------------------------------------------------------------- */
@@ -26,6 +26,7 @@
  */
 
 #include "rascal/representations/calculator_spherical_expansion.hh"
+#include "rascal/utils/instrumentation.hh"
 #include "rascal/utils/utils.hh"
 
 #include <boost/mpl/list.hpp>
@@ -78,5 +79,31 @@ namespace rascal {
                                     OptimizationType::Interpolator),
                       11);
   }
+
+  BOOST_AUTO_TEST_CASE(instrumentation_test) {
+    instrumentation::reset();
+    instrumentation::enable(false);
+    instrumentation::add_count("counter", 3);
+    { instrumentation::ScopedTimer timer{"timer"}; }
+    json report = instrumentation::get_report();
+    BOOST_CHECK(report["counters"].empty());
+    BOOST_CHECK(report["timers"].empty());
+
+    instrumentation::enable();
+    BOOST_CHECK(instrumentation::is_enabled());
+    instrumentation::add_count("counter", 3);
+    instrumentation::add_count("counter");
+    for (int i_call{0}; i_call < 2; ++i_call) {
+      instrumentation::ScopedTimer timer{"timer"};
+    }
+    instrumentation::enable(false);
+    report = instrumentation::get_report();
+    BOOST_CHECK_EQUAL(report["counters"]["counter"].get<size_t>(), 4);
+    BOOST_CHECK_EQUAL(report["timers"]["timer"]["calls"].get<size_t>(), 2);
+    BOOST_CHECK_GE(report["timers"]["timer"]["seconds"].get<double>(), 0.);
+
+    instrumentation::reset();
+    BOOST_CHECK(instrumentation::get_report()["counters"].empty());
+  }
   BOOST_AUTO_TEST_SUITE_END();
 }  // namespace rascal